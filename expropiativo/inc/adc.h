@@ -0,0 +1,113 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ADC_H
+#define ADC_H
+
+/** \brief Analog input streaming declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de muestras de cada uno de los dos bloques del buffer de adquisición
+#ifndef ADC_BLOCK_SIZE
+    #define ADC_BLOCK_SIZE 64
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar una adquisición continua de una entrada analógica
+typedef struct adc_stream_s * adc_stream_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear una adquisición continua de una entrada analógica
+ *
+ * Un temporizador dispara las conversiones del ADC a la frecuencia indicada y el controlador de
+ * DMA guarda los resultados alternando entre dos bloques de ADC_BLOCK_SIZE muestras, de manera que
+ * el procesador solo interviene una vez por cada bloque completo.
+ *
+ * @param   channel         Canal del ADC0 que se muestrea
+ * @param   sample_rate     Frecuencia de muestreo en Hz
+ * @return  adc_stream_t    Puntero al descriptor de la adquisición, NULL si no hay recursos o
+ *                          la frecuencia es cero o mayor a la mitad del reloj del temporizador
+ */
+adc_stream_t AdcStreamCreate(uint8_t channel, uint32_t sample_rate);
+
+/**
+ * @brief Metodo para esperar el próximo bloque de muestras de una adquisición
+ *
+ * La tarea que llama queda bloqueada hasta que el DMA completa un bloque. Las muestras se
+ * convierten en el mismo lugar a formato Q15 con signo, centradas en la mitad de la escala, y
+ * son validas hasta que el DMA vuelve a escribir ese bloque, es decir durante el tiempo de
+ * adquisición de ADC_BLOCK_SIZE muestras.
+ *
+ * @param   stream      Puntero al descriptor de la adquisición
+ * @return  int16_t *   Puntero a las ADC_BLOCK_SIZE muestras del bloque completado
+ */
+int16_t * AdcStreamRead(adc_stream_t stream);
+
+/**
+ * @brief Metodo para consultar los bloques descartados por una adquisición
+ *
+ * @param   stream      Puntero al descriptor de la adquisición
+ * @return  uint32_t    Cantidad de bloques que se perdieron porque no se leyeron a tiempo
+ */
+uint32_t AdcStreamOverruns(adc_stream_t stream);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* ADC_H */
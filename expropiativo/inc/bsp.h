@@ -76,6 +76,8 @@ board_t BoardCreate(void);
 
 void SisTick_Init(uint16_t ticks);
 
+void SisTick_Update(void);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
@@ -113,6 +113,30 @@ extern "C" {
 #define TEC_4_GPIO 1
 #define TEC_4_BIT 9
 
+#define ANALOG_1_CHANNEL 1
+#define ANALOG_2_CHANNEL 2
+#define ANALOG_3_CHANNEL 3
+
+#define SPI_MISO_PORT 1
+#define SPI_MISO_PIN 3
+#define SPI_MISO_FUNC SCU_MODE_FUNC5
+
+#define SPI_MOSI_PORT 1
+#define SPI_MOSI_PIN 4
+#define SPI_MOSI_FUNC SCU_MODE_FUNC5
+
+#define SPI_SCK_PORT 0xF
+#define SPI_SCK_PIN 4
+#define SPI_SCK_FUNC SCU_MODE_FUNC0
+
+#define UART_USB_TX_PORT 7
+#define UART_USB_TX_PIN 1
+#define UART_USB_TX_FUNC SCU_MODE_FUNC6
+
+#define UART_USB_RX_PORT 7
+#define UART_USB_RX_PIN 2
+#define UART_USB_RX_FUNC SCU_MODE_FUNC6
+
 /* === Public data type declarations =========================================================== */
  
 /* === Public variable declarations ============================================================ */
@@ -0,0 +1,121 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+/** \brief Core clock configuration declarations
+ **
+ ** Configura el PLL principal para que el procesador funcione a una frecuencia conocida, en lugar
+ ** de depender de la configuración que dejó el código de arranque, y ajusta los estados de espera
+ ** de la memoria flash para cada frecuencia. Al cambiar de perfil se recalcula la interrupción
+ ** periódica del sistema, de manera que el núcleo mantiene TICKS_PER_SECOND.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Frecuencia del procesador en el perfil de máximo rendimiento, la máxima del LPC4337
+#ifndef CLOCK_PERFORMANCE_FREQUENCY
+    #define CLOCK_PERFORMANCE_FREQUENCY 204000000
+#endif
+
+//! Frecuencia del procesador en el perfil de bajo consumo
+#ifndef CLOCK_LOW_POWER_FREQUENCY
+    #define CLOCK_LOW_POWER_FREQUENCY 48000000
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Perfiles de funcionamiento del reloj del procesador
+typedef enum {
+    CLOCK_PROFILE_PERFORMANCE = 0, //!< Máxima frecuencia, con los estados de espera necesarios
+    CLOCK_PROFILE_LOW_POWER,       //!< Frecuencia reducida para disminuir el consumo
+} clock_profile_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para cambiar el perfil de funcionamiento del reloj del procesador
+ *
+ * Reprograma el PLL principal a partir del cristal de 12 MHz. Los estados de espera de la flash
+ * se aumentan antes de subir la frecuencia y se reducen después de bajarla, para que nunca
+ * queden por debajo de los necesarios. Si el temporizador del sistema ya fue configurado se
+ * recalcula su recarga para la nueva frecuencia.
+ *
+ * @remark Los periféricos que toman su reloj del PLL principal cambian su frecuencia junto con la
+ *         del procesador, por lo que deben configurarse después de elegir el perfil.
+ *
+ * @param   profile     Perfil de funcionamiento
+ * @return  uint32_t    Frecuencia del procesador en Hz después del cambio
+ */
+uint32_t ClockSetProfile(clock_profile_t profile);
+
+/**
+ * @brief Metodo para consultar el perfil de funcionamiento actual
+ *
+ * @return  clock_profile_t     Perfil de funcionamiento actual
+ */
+clock_profile_t ClockGetProfile(void);
+
+/**
+ * @brief Metodo para consultar la frecuencia actual del procesador
+ *
+ * @return  uint32_t    Frecuencia del procesador en Hz
+ */
+uint32_t ClockGetFrequency(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* CLOCK_H */
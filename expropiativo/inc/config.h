@@ -0,0 +1,143 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+/** \brief Persistent configuration parameters declarations
+ **
+ ** Los parámetros se identifican por un numero entre cero y la cantidad indicada al cargarlos,
+ ** y se guardan en la EEPROM interna como un registro circular de cambios, de manera que cada
+ ** página se programa solo una vez por vuelta del registro.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad máxima de parámetros
+#define CONFIG_MAX_PARAMETERS 32
+
+//! Primera página de la EEPROM usada por el registro de parámetros
+#ifndef CONFIG_FIRST_PAGE
+    #define CONFIG_FIRST_PAGE 0
+#endif
+
+//! Cantidad de páginas de la EEPROM usadas por el registro de parámetros
+#ifndef CONFIG_PAGES
+    #define CONFIG_PAGES 32
+#endif
+
+//! Tiempo en milisegundos sin cambios antes de guardar los parámetros modificados
+#ifndef CONFIG_COMMIT_DELAY
+    #define CONFIG_COMMIT_DELAY 2000
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para cargar los parámetros guardados en la EEPROM
+ *
+ * Recorre una sola vez las páginas del registro y se queda, para cada parámetro, con el valor de
+ * la página más reciente. Los parámetros que nunca se guardaron toman su valor por defecto.
+ *
+ * @param   defaults    Valores por defecto de los parámetros
+ * @param   count       Cantidad de parámetros, hasta CONFIG_MAX_PARAMETERS
+ * @return  true        Los parámetros se cargaron correctamente
+ * @return  false       La cantidad de parámetros no es valida o no hay recursos en el núcleo
+ */
+bool ConfigLoad(const uint32_t * defaults, uint8_t count);
+
+/**
+ * @brief Metodo para obtener el valor actual de un parámetro
+ *
+ * @param   id          Numero del parámetro
+ * @return  uint32_t    Valor del parámetro, o cero si el numero no es valido
+ */
+uint32_t ConfigGet(uint8_t id);
+
+/**
+ * @brief Metodo para cambiar el valor de un parámetro
+ *
+ * El nuevo valor se usa inmediatamente, pero recién se guarda cuando pasan CONFIG_COMMIT_DELAY
+ * milisegundos sin otros cambios, junto con todos los parámetros modificados en ese lapso. Puede
+ * llamarse desde una tarea o desde una rutina de servicio de interrupción.
+ *
+ * @param   id          Numero del parámetro
+ * @param   value       Nuevo valor del parámetro
+ */
+void ConfigSet(uint8_t id, uint32_t value);
+
+/**
+ * @brief Metodo para guardar inmediatamente los parámetros modificados
+ *
+ * @remark Solo puede llamarse desde una tarea
+ *
+ * @return  true        Los parámetros se guardaron correctamente
+ * @return  false       No se cargaron los parámetros previamente
+ */
+bool ConfigCommit(void);
+
+/**
+ * @brief Tarea que guarda los parámetros modificados cuando se cumple la demora
+ *
+ * Es opcional, sin esta tarea los cambios solo se guardan al llamar a ConfigCommit.
+ */
+void ConfigTask(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* CONFIG_H */
@@ -0,0 +1,110 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+/** \brief Cyclic redundancy check declarations
+ **
+ ** En el Cortex-M4 las sumas se calculan con el motor CRC del LPC4337, alimentado por DMA en los
+ ** bloques grandes. En cualquier otro procesador, o si el núcleo no tiene semáforos libres para
+ ** el motor, se calculan por software con tablas, con el mismo resultado, de manera que los
+ ** protocolos puedan verificarse en el equipo de desarrollo.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad mínima de bytes de un bloque para alimentar el motor CRC por DMA
+#ifndef CRC_DMA_THRESHOLD
+    #define CRC_DMA_THRESHOLD 256
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para calcular la suma CRC-16/CCITT-FALSE de un bloque
+ *
+ * Polinomio 0x1021, valor inicial 0xFFFF, sin reflejar y sin complementar el resultado.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción, porque espera el
+ * acceso exclusivo al motor CRC en un semaforo
+ *
+ * @param   data        Datos del bloque
+ * @param   length      Cantidad de bytes del bloque
+ * @return  uint16_t    Suma del bloque
+ */
+uint16_t Crc16(const void * data, uint32_t length);
+
+/**
+ * @brief Metodo para calcular la suma CRC-32 de un bloque
+ *
+ * Polinomio 0x04C11DB7 reflejado, valor inicial 0xFFFFFFFF y resultado complementado, igual al
+ * de Ethernet y zlib. Los bloques de al menos CRC_DMA_THRESHOLD bytes se transfieren al motor CRC
+ * por DMA y la tarea queda bloqueada, sin consumir tiempo de procesador, hasta que termina.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción, porque espera el
+ * acceso exclusivo al motor CRC y el final del DMA en semaforos
+ *
+ * @param   data        Datos del bloque
+ * @param   length      Cantidad de bytes del bloque
+ * @return  uint32_t    Suma del bloque
+ */
+uint32_t Crc32(const void * data, uint32_t length);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* CRC_H */
@@ -76,6 +76,13 @@ typedef struct digital_output_s * digital_output_t;
  */
 digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted);
 
+/**
+ * @brief Metodo para devolver el descriptor de una entrada digital que ya no se usa
+ * 
+ * @param   input   Puntero al descriptor de la entrada, se ignora si es NULL
+ */
+void DigitalInputDestroy(digital_input_t input);
+
 /**
  * @brief Metodo para consultar el estado de una entrada digital
  * 
@@ -121,6 +128,15 @@ bool DigitalInputHasDeactivated(digital_input_t input);
  */
 digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin);
 
+/**
+ * @brief Metodo para devolver el descriptor de una salida digital que ya no se usa
+ * 
+ * El terminal vuelve a configurarse como entrada para no seguir manejando la línea.
+ * 
+ * @param   output  Puntero al descriptor de la salida, se ignora si es NULL
+ */
+void DigitalOutputDestroy(digital_output_t output);
+
 /**
  * @brief Metodo para prender una salida digital
  * 
@@ -0,0 +1,129 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+/** \brief Multiplexed seven segments display declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de digitos de la pantalla
+#define DISPLAY_DIGITS 4
+
+//! Frecuencia en Hz con la que se cambia el digito encendido
+#ifndef DISPLAY_REFRESH_RATE
+    #define DISPLAY_REFRESH_RATE 1000
+#endif
+
+#define DISPLAY_SEGMENT_A (1 << 0)
+#define DISPLAY_SEGMENT_B (1 << 1)
+#define DISPLAY_SEGMENT_C (1 << 2)
+#define DISPLAY_SEGMENT_D (1 << 3)
+#define DISPLAY_SEGMENT_E (1 << 4)
+#define DISPLAY_SEGMENT_F (1 << 5)
+#define DISPLAY_SEGMENT_G (1 << 6)
+#define DISPLAY_SEGMENT_P (1 << 7)
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar la pantalla
+typedef struct display_s * display_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear la pantalla del poncho de expansión
+ *
+ * Configura los terminales de segmentos y digitos y arranca el temporizador TIMER1, cuya
+ * interrupción enciende un digito por vez a partir de la memoria de la pantalla. El refresco no
+ * depende de ninguna tarea, por lo que el brillo es parejo sin importar la carga del sistema.
+ *
+ * @return  display_t   Puntero al descriptor de la pantalla, o NULL si ya fue creada
+ */
+display_t DisplayCreate(void);
+
+/**
+ * @brief Metodo para mostrar un número en formato BCD
+ *
+ * @param   display     Puntero al descriptor de la pantalla
+ * @param   number      Digitos del número, empezando por el de la izquierda
+ * @param   size        Cantidad de digitos del número, se completa con digitos apagados
+ */
+void DisplayWriteBcd(display_t display, const uint8_t * number, uint8_t size);
+
+/**
+ * @brief Metodo para mostrar un patrón arbitrario de segmentos en un digito
+ *
+ * @param   display     Puntero al descriptor de la pantalla
+ * @param   digit       Digito a modificar, empezando por cero a la izquierda
+ * @param   segments    Combinación de las constantes DISPLAY_SEGMENT_x
+ */
+void DisplayWriteSegments(display_t display, uint8_t digit, uint8_t segments);
+
+/**
+ * @brief Metodo para encender o apagar el punto de un digito
+ *
+ * @param   display     Puntero al descriptor de la pantalla
+ * @param   digit       Digito a modificar, empezando por cero a la izquierda
+ * @param   on          Estado del punto
+ */
+void DisplaySetPoint(display_t display, uint8_t digit, bool on);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* DISPLAY_H */
@@ -0,0 +1,155 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EVENT_H
+#define EVENT_H
+
+/** \brief Publish/subscribe event bus declarations
+ **
+ ** Los eventos se identifican por un tópico y las listas de suscriptores de cada tópico se fijan
+ ** al compilar, en la tabla event_topics que define la aplicación. Publicar un evento recorre la
+ ** lista del tópico y marca la bandera del evento en cada tarea suscripta o envía un mensaje a su
+ ** cola, sin registrar nada en tiempo de ejecución y sin reservar memoria por cada evento.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "kernel.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de tópicos de eventos del sistema, como máximo 32
+#ifndef EVENT_TOPICS
+    #define EVENT_TOPICS 8
+#endif
+
+//! Valor del campo task de un suscriptor que recibe los eventos solamente por una cola
+#define EVENT_NO_TASK (-1)
+
+//! Define en la tabla de tópicos la lista de suscriptores de un tópico
+#define EVENT_TOPIC(list) {.subscribers = (list), .count = sizeof(list) / sizeof((list)[0])}
+
+//! Define un suscriptor que recibe los eventos como banderas de la tarea indicada
+#define EVENT_FLAG(tarea) {.task = (tarea), .queue = NULL}
+
+//! Define un suscriptor que recibe los eventos como mensajes en la cola indicada
+#define EVENT_QUEUE(cola) {.task = EVENT_NO_TASK, .queue = &(cola)}
+
+//! Mascara con la bandera correspondiente a un tópico
+#define EVENT_MASK(topic) (1UL << (topic))
+
+//! Mensaje que se envía a las colas suscriptas cuando se publica un tópico
+#define EVENT_MESSAGE(topic) ((void *)(uintptr_t)((topic) + 1))
+
+//! Tópico de un mensaje recibido desde una cola suscripta
+#define EVENT_MESSAGE_TOPIC(message) ((uint8_t)((uintptr_t)(message) - 1))
+
+/* === Public data type declarations =========================================================== */
+
+//! Estructura con la descripción de un suscriptor de un tópico
+typedef struct event_subscriber_s {
+    int task;       //!< Tarea que recibe la bandera del evento, o EVENT_NO_TASK
+    cola_t * queue; //!< Variable con la cola que recibe el mensaje del evento, o NULL
+} event_subscriber_t;
+
+//! Estructura con la lista de suscriptores de un tópico
+typedef struct event_topic_s {
+    const event_subscriber_t * subscribers; //!< Suscriptores del tópico
+    uint8_t count;                          //!< Cantidad de suscriptores del tópico
+} event_topic_t;
+
+/* === Public variable declarations ============================================================ */
+
+/**
+ * @brief Tabla con los suscriptores de cada tópico, que define la aplicación
+ *
+ * Los tópicos sin suscriptores pueden omitirse. Si la aplicación no define la tabla se usa una
+ * tabla vacía y los eventos publicados se descartan.
+ */
+extern const event_topic_t event_topics[EVENT_TOPICS];
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para publicar un evento
+ *
+ * Marca la bandera del tópico en cada tarea suscripta y la despierta, y envía el mensaje del
+ * tópico a cada cola suscripta. Si una cola está llena el mensaje se descarta y se cuenta como
+ * perdido. Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   topic       Tópico del evento, entre 0 y EVENT_TOPICS - 1
+ */
+void EventPublish(uint8_t topic);
+
+/**
+ * @brief Metodo para esperar eventos en la tarea actual
+ *
+ * Bloquea a la tarea hasta que se publique al menos uno de los tópicos indicados, a los que la
+ * tarea debe estar suscripta por bandera. Las banderas devueltas se borran y las demás se
+ * conservan para una próxima espera.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   topics      Mascara con los tópicos esperados, armada con EVENT_MASK
+ * @return  uint32_t    Mascara con los tópicos publicados desde la última espera
+ */
+uint32_t EventWait(uint32_t topics);
+
+/**
+ * @brief Metodo para consultar la cantidad de mensajes descartados por colas llenas
+ *
+ * @return  uint32_t    Cantidad de mensajes descartados desde el arranque
+ */
+uint32_t EventOverruns(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* EVENT_H */
@@ -0,0 +1,138 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+/** \brief Fixed point spectral analysis declarations
+ **
+ ** Transformada rápida de Fourier de bloques de muestras reales en formato Q15, calculada en el
+ ** mismo lugar a partir de una transformada compleja de la mitad del tamaño.
+ **
+ ** El costo de cada bloque de N muestras lo dominan las mariposas de la transformada compleja
+ ** de N/2 puntos, que se cuentan exactamente: una etapa de N/8 mariposas de base 4 por cada par
+ ** de bits de log2(N/2), una etapa de N/4 mariposas de base 2 si queda un bit suelto, y N/4 pasos
+ ** de separación de la transformada real.
+ **
+ ** La tabla no incluye los ciclos por bloque porque todavía no se midieron en el LPC4337, por lo
+ ** que ese requisito del análisis sigue sin cumplirse. Se obtienen con FftBenchmark en la placa,
+ ** con las opciones de compilación definitivas, y deberían crecer en proporción a la suma de los
+ ** conteos de operaciones.
+ **
+ ** |   N | Base 4 | Base 2 | Separación |
+ ** |-----|--------|--------|------------|
+ ** |  32 |      8 |      0 |          8 |
+ ** |  64 |     16 |     16 |         16 |
+ ** | 128 |     48 |      0 |         32 |
+ ** | 256 |     96 |     64 |         64 |
+ ** | 512 |    256 |      0 |        128 |
+ **
+ ** \addtogroup dsp DSP
+ ** \brief Procesamiento digital de señales
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad máxima de muestras de un bloque, fijada por la tabla de factores de giro
+#define FFT_MAX_SIZE 512
+
+//! Cantidad mínima de muestras de un bloque
+#define FFT_MIN_SIZE 8
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para calcular la transformada de un bloque de muestras reales
+ *
+ * El bloque se reemplaza por los coeficientes X[0] a X[N/2 - 1] como pares {real, imaginario}
+ * escalados por 1/N. Como X[0] y X[N/2] son reales, la parte real de X[N/2] se guarda en el
+ * lugar de la parte imaginaria de X[0].
+ *
+ * @param   samples     Bloque de N muestras en formato Q15, alineado a 32 bits
+ * @param   size        Cantidad de muestras, potencia de dos entre FFT_MIN_SIZE y FFT_MAX_SIZE
+ * @return  true        La transformada se calculó correctamente
+ * @return  false       El tamaño del bloque no está soportado
+ */
+bool FftReal(int16_t * samples, uint16_t size);
+
+/**
+ * @brief Metodo para calcular la potencia de cada componente de una transformada
+ *
+ * @param   spectrum    Resultado de FftReal para un bloque de N muestras
+ * @param   power       Potencia de las componentes 0 a N/2 - 1 en formato Q30
+ * @param   size        Cantidad de muestras del bloque transformado
+ */
+void FftPower(const int16_t * spectrum, uint32_t * power, uint16_t size);
+
+/**
+ * @brief Metodo para buscar la componente de mayor potencia de un espectro
+ *
+ * @param   power       Potencia de las componentes calculada con FftPower
+ * @param   size        Cantidad de muestras del bloque transformado
+ * @return  uint16_t    Indice de la componente de mayor potencia, sin incluir la continua
+ */
+uint16_t FftPeak(const uint32_t * power, uint16_t size);
+
+/**
+ * @brief Metodo para medir los ciclos de procesador que consume la transformada de un bloque
+ *
+ * @param   size        Cantidad de muestras del bloque
+ * @return  uint32_t    Ciclos consumidos por FftReal, o cero si el tamaño no está soportado
+ */
+uint32_t FftBenchmark(uint16_t size);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* FFT_H */
@@ -0,0 +1,215 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FILTER_H
+#define FILTER_H
+
+/** \brief Fixed point digital filters declarations
+ **
+ ** \addtogroup dsp DSP
+ ** \brief Procesamiento digital de señales
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad máxima de coeficientes de un filtro FIR
+#ifndef FILTER_MAX_TAPS
+    #define FILTER_MAX_TAPS 32
+#endif
+
+//! Cantidad máxima de muestras que se procesan en cada pasada de un filtro FIR
+#ifndef FILTER_BLOCK_SIZE
+    #define FILTER_BLOCK_SIZE 64
+#endif
+
+//! Cantidad máxima de secciones de segundo orden de un filtro IIR
+#ifndef BIQUAD_MAX_STAGES
+    #define BIQUAD_MAX_STAGES 4
+#endif
+
+//! Cantidad de filtros FIR disponibles en el sistema
+#ifndef FIR_INSTANCES
+    #define FIR_INSTANCES 2
+#endif
+
+//! Cantidad de filtros IIR disponibles en el sistema, para cada formato
+#ifndef BIQUAD_INSTANCES
+    #define BIQUAD_INSTANCES 2
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar un filtro FIR en formato Q15
+typedef struct fir_s * fir_t;
+
+//! Referencia a un descriptor para gestionar un filtro IIR en formato Q15
+typedef struct biquad_s * biquad_t;
+
+//! Referencia a un descriptor para gestionar un filtro IIR en formato Q31
+typedef struct biquad_q31_s * biquad_q31_t;
+
+//! Ciclos de procesador consumidos por cada núcleo de cálculo y por su versión en C
+typedef struct filter_benchmark_s {
+    uint32_t fir;              //!< Filtro FIR con instrucciones SIMD
+    uint32_t fir_reference;    //!< Filtro FIR en C
+    uint32_t biquad;           //!< Filtro IIR Q15 con instrucciones SIMD
+    uint32_t biquad_reference; //!< Filtro IIR Q15 en C
+    uint32_t add;              //!< Suma saturada con instrucciones SIMD
+    uint32_t add_reference;    //!< Suma saturada en C
+    bool mismatch;             //!< Algún núcleo no coincidió bit a bit con su versión en C
+} * filter_benchmark_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear un filtro FIR
+ *
+ * @param   coefficients    Coeficientes h[0] a h[taps - 1] en formato Q15
+ * @param   taps            Cantidad de coeficientes, como máximo FILTER_MAX_TAPS
+ * @return  fir_t           Puntero al descriptor del filtro creado
+ */
+fir_t FirCreate(const int16_t * coefficients, uint16_t taps);
+
+/**
+ * @brief Metodo para filtrar un bloque de muestras con un filtro FIR
+ *
+ * Cada salida se acumula en 64 bits sumando dos productos por instrucción, por lo que el
+ * resultado es exacto antes de la saturación final a Q15. La salida puede escribirse sobre la
+ * misma memoria que la entrada.
+ *
+ * @param   fir     Puntero al descriptor del filtro
+ * @param   input   Muestras de entrada en formato Q15
+ * @param   output  Muestras de salida en formato Q15
+ * @param   count   Cantidad de muestras del bloque
+ */
+void FirProcess(fir_t fir, const int16_t * input, int16_t * output, uint16_t count);
+
+/**
+ * @brief Metodo para crear un filtro IIR como una cascada de secciones de segundo orden
+ *
+ * Cada sección se describe con cinco coeficientes {b0, b1, b2, a1, a2} que implementan
+ * y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2], es decir con los coeficientes
+ * de realimentación ya cambiados de signo. Los coeficientes se escalan por 2^-shift para poder
+ * representar valores mayores a uno.
+ *
+ * @param   coefficients    Cinco coeficientes por sección en formato Q15
+ * @param   stages          Cantidad de secciones, como máximo BIQUAD_MAX_STAGES
+ * @param   shift           Escala de los coeficientes
+ * @return  biquad_t        Puntero al descriptor del filtro creado
+ */
+biquad_t BiquadCreate(const int16_t * coefficients, uint8_t stages, uint8_t shift);
+
+/**
+ * @brief Metodo para filtrar un bloque de muestras con un filtro IIR en formato Q15
+ *
+ * Cada sección acumula en 32 bits, por lo que la entrada debe dejar dos bits de margen para que
+ * las sumas intermedias no desborden. La salida puede escribirse sobre la entrada.
+ *
+ * @param   biquad  Puntero al descriptor del filtro
+ * @param   input   Muestras de entrada en formato Q15
+ * @param   output  Muestras de salida en formato Q15
+ * @param   count   Cantidad de muestras del bloque
+ */
+void BiquadProcess(biquad_t biquad, const int16_t * input, int16_t * output, uint16_t count);
+
+/**
+ * @brief Metodo para crear un filtro IIR de alta precisión
+ *
+ * Igual que BiquadCreate pero con coeficientes en formato Q31, necesario cuando los polos están
+ * muy cerca del circulo unitario como en los filtros de muy baja frecuencia de corte.
+ *
+ * @param   coefficients    Cinco coeficientes por sección en formato Q31
+ * @param   stages          Cantidad de secciones, como máximo BIQUAD_MAX_STAGES
+ * @param   shift           Escala de los coeficientes
+ * @return  biquad_q31_t    Puntero al descriptor del filtro creado
+ */
+biquad_q31_t BiquadQ31Create(const int32_t * coefficients, uint8_t stages, uint8_t shift);
+
+/**
+ * @brief Metodo para filtrar un bloque de muestras con un filtro IIR en formato Q31
+ *
+ * @param   biquad  Puntero al descriptor del filtro
+ * @param   input   Muestras de entrada en formato Q31
+ * @param   output  Muestras de salida en formato Q31
+ * @param   count   Cantidad de muestras del bloque
+ */
+void BiquadQ31Process(biquad_q31_t biquad, const int32_t * input, int32_t * output,
+                      uint16_t count);
+
+/**
+ * @brief Metodo para sumar con saturación dos bloques de muestras en formato Q15
+ *
+ * @param   first   Primer bloque de muestras
+ * @param   second  Segundo bloque de muestras
+ * @param   output  Bloque con la suma, puede coincidir con cualquiera de las entradas
+ * @param   count   Cantidad de muestras de los bloques
+ */
+void FilterAdd(const int16_t * first, const int16_t * second, int16_t * output, uint16_t count);
+
+/**
+ * @brief Metodo para comparar los núcleos de cálculo con sus versiones en C
+ *
+ * Filtra BENCHMARK_ITERATIONS bloques de FILTER_BLOCK_SIZE muestras con cada núcleo y con su
+ * equivalente escrito en C sin instrucciones SIMD, midiendo el tiempo total de cada uno con el
+ * contador de ciclos del procesador. Ambas versiones parten del mismo estado inicial y escriben
+ * en buffers distintos, que luego se comparan bit a bit. Al compilar para el equipo de
+ * desarrollo las instrucciones SIMD se emulan en C y se mide con el reloj de la biblioteca
+ * estándar.
+ *
+ * @param   result  Puntero a la estructura donde se devuelven las mediciones
+ */
+void FilterBenchmark(filter_benchmark_t result);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* FILTER_H */
@@ -0,0 +1,148 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef I2C_H
+#define I2C_H
+
+/** \brief Interrupt driven I2C master declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de transacciones que pueden estar pendientes en el bus
+#ifndef I2C_QUEUE_LENGTH
+    #define I2C_QUEUE_LENGTH 8
+#endif
+
+//! Tiempo máximo en milisegundos de una transacción que no indica uno propio
+#ifndef I2C_DEFAULT_TIMEOUT
+    #define I2C_DEFAULT_TIMEOUT 10
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Resultados posibles de una transacción sobre el bus I2C
+typedef enum {
+    I2C_PENDING = 0,          //!< La transacción está en la cola o en curso
+    I2C_OK,                   //!< La transacción terminó correctamente
+    I2C_NACK,                 //!< El dispositivo no reconoció la dirección o un dato
+    I2C_ARBITRATION_LOST,     //!< Otro maestro tomó el bus durante la transacción
+    I2C_BUS_ERROR,            //!< Se detectó una condición de inicio o fin fuera de lugar
+    I2C_TIMEOUT,              //!< La transacción no terminó en el tiempo máximo
+} i2c_status_t;
+
+//! Transacción sobre el bus I2C, la memoria es provista por la tarea que la solicita
+typedef struct i2c_transfer_s {
+    uint8_t address;               //!< Dirección de 7 bits del dispositivo
+    const uint8_t * tx;            //!< Datos a escribir antes de leer
+    uint16_t tx_length;            //!< Cantidad de bytes a escribir, puede ser cero
+    uint8_t * rx;                  //!< Espacio para los datos leídos
+    uint16_t rx_length;            //!< Cantidad de bytes a leer, puede ser cero
+    uint16_t timeout;              //!< Tiempo máximo en milisegundos, cero por defecto
+    volatile i2c_status_t status;  //!< Resultado de la transacción, asignado por el controlador
+    int task;                      //!< Tarea que se notifica al terminar, asignada al encolar
+} * i2c_transfer_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para configurar el bus I2C de la placa
+ *
+ * Configura el controlador I2C0 en sus terminales dedicados y habilita su interrupción.
+ *
+ * @param   bitrate     Frecuencia de reloj del bus en Hz, hasta 400 KHz
+ * @return  true        El bus se configuró correctamente
+ * @return  false       El bus ya estaba configurado
+ */
+bool I2cInit(uint32_t bitrate);
+
+/**
+ * @brief Metodo para encolar una transacción en el bus sin esperar a que termine
+ *
+ * La transacción escribe los datos de transmisión y, con una condición de inicio repetida, lee
+ * los datos de recepción. Si alguna de las dos partes tiene longitud cero se omite. La memoria de
+ * la transacción y de sus datos debe permanecer valida hasta que la misma termine.
+ *
+ * @param   transfer    Puntero a la transacción
+ * @return  true        La transacción se encoló correctamente
+ * @return  false       La cola está llena o la transacción no tiene datos
+ */
+bool I2cSubmit(i2c_transfer_t transfer);
+
+/**
+ * @brief Metodo para esperar que termine una transacción encolada
+ *
+ * La tarea que llama queda bloqueada, sin consumir tiempo de procesador, hasta que la
+ * interrupción del controlador termina la transacción o se vence su tiempo máximo.
+ *
+ * @remark Debe llamarla la misma tarea que encoló la transacción
+ *
+ * @param   transfer        Puntero a la transacción
+ * @return  i2c_status_t    Resultado de la transacción
+ */
+i2c_status_t I2cWait(i2c_transfer_t transfer);
+
+/**
+ * @brief Metodo para realizar una transacción y esperar a que termine
+ *
+ * @param   transfer        Puntero a la transacción
+ * @return  i2c_status_t    Resultado de la transacción, I2C_PENDING si no se pudo encolar
+ */
+i2c_status_t I2cTransfer(i2c_transfer_t transfer);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* I2C_H */
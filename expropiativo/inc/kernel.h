@@ -0,0 +1,626 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef KERNEL_H
+#define KERNEL_H
+
+/** \brief Declaraciones del núcleo expropiativo
+ **
+ ** \addtogroup kernel Kernel
+ ** \brief Núcleo de planificación expropiativo
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/*
+ * Ganchos del núcleo: para instrumentar los cambios de contexto y el tick se define al compilar
+ * el nombre de la función a llamar, por ejemplo -DKERNEL_HOOK_TICK=MedirTick, y la aplicación la
+ * implementa. El núcleo la llama en forma directa, y si el gancho no se define no se genera
+ * ninguna instrucción.
+ *
+ * KERNEL_HOOK_SWITCH_OUT   void f(int id), tarea que deja el procesador
+ * KERNEL_HOOK_SWITCH_IN    void f(int id), tarea que recibe el procesador
+ * KERNEL_HOOK_TICK         void f(void), al comienzo de cada tick del sistema
+ *
+ * Los ganchos se ejecutan en las interrupciones PendSV y SysTick, deben ser breves y no pueden
+ * bloquear. Cuando no hay tareas listas el id es TASK_COUNT.
+ */
+
+/** Cantidad de bytes para la pila de cada tarea */
+#ifndef STACK_SIZE
+    #define STACK_SIZE 256
+#endif
+
+/** Cantidad de tareas */
+#ifndef TASK_COUNT
+    #define TASK_COUNT 4
+#endif
+
+/** Valor con el que se llena la pila libre de cada tarea para medir su uso */
+#define STACK_PATTERN 0xA5
+
+/** Cantidad de colas disponibles en el sistema */
+#ifndef QUEUE_INSTANCES
+    #define QUEUE_INSTANCES 8
+#endif
+
+/**
+ * Cantidad de semaforos que usan los módulos del HAL por fuera de las colas: adc 1, config 3,
+ * crc 2, keypad 1, logger 1, protocol 3, uno por dispositivo spi y uno por pool de buffers
+ */
+#ifndef DRIVER_SEMAPHORES
+    #define DRIVER_SEMAPHORES 20
+#endif
+
+/** Cantidad de semaforos disponibles en el sistema, cada cola usa dos */
+#ifndef SEMAPHORE_INSTANCES
+    #define SEMAPHORE_INSTANCES (2 * QUEUE_INSTANCES + DRIVER_SEMAPHORES)
+#endif
+
+/** Cantidad máxima de elementos de una cola */
+#ifndef QUEUE_LENGTH
+    #define QUEUE_LENGTH 8
+#endif
+
+/** Cantidad de niveles de prioridad de las tareas, hasta 32 */
+#ifndef PRIORITY_LEVELS
+    #define PRIORITY_LEVELS 8
+#endif
+
+/** Cantidad de particiones temporales, la partición cero no tiene presupuesto por defecto */
+#ifndef PARTITION_COUNT
+    #define PARTITION_COUNT 4
+#endif
+
+/** Cantidad de temporizadores disponibles en el sistema */
+#ifndef TIMER_INSTANCES
+    #define TIMER_INSTANCES 4
+#endif
+
+/** Frecuencia de la interrupción periódica del sistema */
+#ifndef TICKS_PER_SECOND
+    #define TICKS_PER_SECOND 5000
+#endif
+
+/** Conversión de un tiempo en milisegundos a ticks del sistema, redondeando hacia arriba */
+#define MS_TO_TICKS(ms) ((((uint32_t)(ms)) * TICKS_PER_SECOND + 999) / 1000)
+
+/**
+ * @brief Declara una tarea con su contexto inicial calculado al compilar
+ *
+ * El descriptor de la tarea, con el contexto inicial ya armado, se ubica en la sección tareas
+ * en la memoria de programa. El núcleo la recorre una sola vez al arrancar y copia cada contexto
+ * al extremo superior de la pila de la tarea, que es la misma que usaría CrearTarea y no ocupa
+ * lugar en la imagen de datos inicializados. Así no hace falta llamar a CrearTarea para cada
+ * tarea.
+ *
+ * @param   id          Numero literal de la tarea, entre 0 y TASK_COUNT - 1
+ * @param   funcion     Función que implementa la tarea
+ * @param   argumento   Valor constante que recibe la función de la tarea como parámetro
+ */
+#define TAREA_DECLARAR(id, funcion, argumento)                                                     \
+    static const struct tarea_declarada_s tarea_declarada_##id                                     \
+        __attribute__((section("tareas"), used)) = {                                               \
+            .numero = (id),                                                                        \
+            .contexto = {                                                                          \
+                .aditional = {.lr = 0xfffffff9},                                                   \
+                .interrupt = {.r0 = (uintptr_t)(argumento), .lr = (uintptr_t)Error,                \
+                              .pc = (uintptr_t)(funcion), .xPSR = 0x01000000},                     \
+            },                                                                                     \
+    }
+
+/* === Public data type declarations =========================================================== */
+
+//! Contexto de una tarea tal como se almacena en su pila mientras no está en ejecución
+struct tarea_contexto_s {
+    //! Registros que guarda el cambio de contexto
+    struct {
+        uintptr_t r4;
+        uintptr_t r5;
+        uintptr_t r6;
+        uintptr_t r7;
+        uintptr_t r8;
+        uintptr_t r9;
+        uintptr_t r10;
+        uintptr_t r11;
+        uintptr_t lr;
+    } aditional;
+    //! Registros que guarda el procesador al atender la interrupción
+    struct {
+        uintptr_t r0;
+        uintptr_t r1;
+        uintptr_t r2;
+        uintptr_t r3;
+        uintptr_t ip;
+        uintptr_t lr;
+        uintptr_t pc;
+        uintptr_t xPSR;
+    } interrupt;
+};
+
+//! Descriptor de una tarea declarada con TAREA_DECLARAR
+struct tarea_declarada_s {
+    int numero;                       //!< Numero de la tarea
+    struct tarea_contexto_s contexto; //!< Contexto inicial, el puntero r7 se completa al copiarlo
+};
+
+//! Estados de una tarea informados por EstadoSistema
+typedef enum {
+    TAREA_ESTADO_SUSPENDIDA = 0, //!< La tarea no fue creada
+    TAREA_ESTADO_LISTA,          //!< La tarea espera su turno para recibir el procesador
+    TAREA_ESTADO_EJECUCION,      //!< La tarea tenía el procesador al tomar el informe
+    TAREA_ESTADO_BLOQUEADA,      //!< La tarea espera un objeto, una notificación o una demora
+} tarea_estado_t;
+
+//! Informe del estado de una tarea, tomado por EstadoSistema
+typedef struct tarea_informe_s {
+    int id;                //!< Numero de la tarea, TASK_COUNT para el sistema operativo
+    tarea_estado_t estado; //!< Estado de la tarea
+    uint8_t prioridad;     //!< Prioridad de la tarea
+    uint8_t particion;     //!< Partición temporal de la tarea
+    void * objeto;         //!< Semaforo en el que espera la tarea bloqueada, o NULL
+    uint32_t despertar;    //!< Tick en el que termina la demora de la tarea, o cero
+    uint16_t pila;         //!< Máxima cantidad de bytes de pila usados desde la creación
+    uint64_t ciclos;       //!< Ciclos de procesador ejecutados desde el arranque
+} tarea_informe_t;
+
+//! Función que se llama cuando una partición agota su presupuesto en el marco principal
+typedef void (*particion_agotada_t)(uint8_t particion);
+
+//! Referencia a un descriptor para gestionar un semaforo
+typedef struct semaforo_s * semaforo_t;
+
+//! Función que implementa una tarea, recibe el argumento indicado al crearla
+typedef void (*tarea_funcion_t)(void * argumento);
+
+//! Referencia a un descriptor para gestionar una cola de punteros
+typedef struct cola_s * cola_t;
+
+//! Referencia a un descriptor para gestionar un temporizador
+typedef struct temporizador_s * temporizador_t;
+
+/**
+ * @brief Función que se ejecuta al vencer un temporizador
+ *
+ * Se ejecuta en el contexto de la interrupción periódica del sistema, por lo que no puede
+ * bloquearse y debe terminar rápidamente.
+ *
+ * @param   datos   Puntero entregado al crear el temporizador
+ */
+typedef void (*temporizador_funcion_t)(void * datos);
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Funcion para configurar el contexto inicial de una tarea
+ *
+ * Esta función asigna la pila de una tarea y prepara el contexto inicial de la misma para que al
+ * atender una interrupción se pueda realizar el cambio de tareas cambiando el puntero de la pila
+ *
+ * @param   id          Numero de la tarea, entre 0 y TASK_COUNT - 1
+ * @param   entry_point Función que implementa la tarea
+ */
+void CrearTarea(int id, void * entry_point);
+
+/**
+ * @brief Funcion para configurar el contexto inicial de una tarea que recibe un argumento
+ *
+ * El argumento se carga en el registro r0 del contexto inicial, por lo que la función de la tarea
+ * lo recibe como su primer parámetro. Así una misma función puede implementar varias tareas,
+ * cada una sobre sus propios datos.
+ *
+ * @param   id          Numero de la tarea, entre 0 y TASK_COUNT - 1
+ * @param   entry_point Función que implementa la tarea
+ * @param   argumento   Valor que recibe la función de la tarea como parámetro
+ */
+void CrearTareaConArgumento(int id, tarea_funcion_t entry_point, void * argumento);
+
+/**
+ * @brief Función para informar al núcleo que transcurrió un tick del sistema
+ *
+ * Debe llamarse desde la interrupción periódica del sistema. Actualiza el tiempo del sistema,
+ * ejecuta los temporizadores vencidos y solicita un cambio de contexto para que la siguiente
+ * tarea lista reciba su cuota de tiempo de procesador.
+ */
+void TickSistema(void);
+
+#ifdef KERNEL_HOOK_SWITCH_OUT
+//! Gancho de la aplicación que se llama cuando una tarea deja el procesador
+void KERNEL_HOOK_SWITCH_OUT(int id);
+#endif
+
+#ifdef KERNEL_HOOK_SWITCH_IN
+//! Gancho de la aplicación que se llama cuando una tarea recibe el procesador
+void KERNEL_HOOK_SWITCH_IN(int id);
+#endif
+
+#ifdef KERNEL_HOOK_TICK
+//! Gancho de la aplicación que se llama en cada tick del sistema
+void KERNEL_HOOK_TICK(void);
+#endif
+
+/**
+ * @brief Función que informa al núcleo la entrada a una rutina de servicio de interrupción
+ *
+ * Mientras haya interrupciones anidadas que entraron con esta función, los cambios de contexto
+ * que solicitan se postergan y se realizan una sola vez, al salir de la más externa.
+ */
+void InterrupcionEntrar(void);
+
+/**
+ * @brief Función que informa al núcleo la salida de una rutina de servicio de interrupción
+ *
+ * Debe llamarse una vez por cada llamada a InterrupcionEntrar. En la salida de la interrupción
+ * más externa se solicita el cambio de contexto postergado, si lo hubo.
+ */
+void InterrupcionSalir(void);
+
+/**
+ * @brief Función para saber si el procesador está atendiendo una interrupción
+ *
+ * @return  true        Se llamó desde una rutina de servicio de interrupción
+ * @return  false       Se llamó desde una tarea o desde el sistema operativo
+ */
+bool InterrupcionActiva(void);
+
+/**
+ * @brief Función para obtener la tarea que se está ejecutando
+ *
+ * @return  int     Numero de la tarea activa, o TASK_COUNT si no hay ninguna tarea lista
+ */
+int TareaActual(void);
+
+/**
+ * @brief Funcion para configurar la duración del marco principal de las particiones temporales
+ *
+ * Al comienzo de cada marco principal se renueva el presupuesto de todas las particiones.
+ *
+ * @param   ticks       Duración del marco principal en ticks del sistema
+ */
+void ParticionesConfigurarMarco(uint32_t ticks);
+
+/**
+ * @brief Funcion para configurar el presupuesto de una partición temporal
+ *
+ * Cada tick del sistema se descuenta del presupuesto de la partición de la tarea en ejecución.
+ * Cuando el presupuesto se agota, las tareas de la partición dejan de recibir el procesador
+ * hasta el comienzo del siguiente marco principal, aunque estén listas y tengan mayor prioridad,
+ * de manera que una tarea que no se bloquea nunca no puede quitarle tiempo a otras particiones.
+ *
+ * @param   particion   Numero de la partición, entre 0 y PARTITION_COUNT - 1
+ * @param   presupuesto Ticks de procesador por marco principal, cero para no limitar
+ * @param   agotada     Función que se llama desde el tick al agotarse el presupuesto, o NULL
+ */
+void ParticionConfigurar(uint8_t particion, uint32_t presupuesto, particion_agotada_t agotada);
+
+/**
+ * @brief Funcion para asignar una tarea a una partición temporal
+ *
+ * Todas las tareas comienzan en la partición cero.
+ *
+ * @param   id          Numero de la tarea, entre 0 y TASK_COUNT - 1
+ * @param   particion   Numero de la partición, entre 0 y PARTITION_COUNT - 1
+ */
+void TareaAsignarParticion(int id, uint8_t particion);
+
+/**
+ * @brief Funcion para asignar la prioridad de una tarea
+ *
+ * Entre las tareas listas siempre se ejecuta la de mayor prioridad, y las de igual prioridad se
+ * alternan en cada tick. Las tareas bloqueadas en un mismo objeto se despiertan también por
+ * prioridad. Todas las tareas comienzan con prioridad cero.
+ *
+ * @param   id          Numero de la tarea, entre 0 y TASK_COUNT - 1
+ * @param   prioridad   Prioridad de la tarea, mayor valor indica mayor prioridad, los valores
+ *                      desde PRIORITY_LEVELS se limitan a PRIORITY_LEVELS - 1
+ */
+void TareaAsignarPrioridad(int id, uint8_t prioridad);
+
+/**
+ * @brief Función para obtener la cantidad de ticks transcurridos desde el arranque
+ *
+ * @return  uint32_t    Cantidad de ticks del sistema
+ */
+uint32_t TiempoSistema(void);
+
+/**
+ * @brief Metodo para demorar a la tarea actual
+ *
+ * La tarea queda bloqueada, sin consumir tiempo de procesador, durante la cantidad de ticks
+ * indicada. Una demora nula espera hasta el próximo tick.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   ticks       Cantidad de ticks del sistema que se demora la tarea
+ */
+void TareaDemorar(uint32_t ticks);
+
+/**
+ * @brief Metodo para demorar a la tarea actual con una tolerancia en el despertar
+ *
+ * La tarea puede despertar hasta holgura ticks más tarde de lo pedido. El núcleo usa esa
+ * tolerancia para hacer coincidir el despertar con el vencimiento de otros temporizadores o
+ * demoras ya programados, o con un tick redondo, de manera que varias actividades periódicas
+ * poco exigentes se atiendan juntas en un mismo tick.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   ticks       Cantidad mínima de ticks del sistema que se demora la tarea
+ * @param   holgura     Cantidad máxima de ticks adicionales que se puede demorar la tarea
+ */
+void TareaDemorarConHolgura(uint32_t ticks, uint32_t holgura);
+
+/**
+ * @brief Metodo para tomar un informe coherente del estado de todas las tareas
+ *
+ * Los datos de todas las tareas se copian juntos en una única sección crítica breve, y el uso de
+ * las pilas se mide después con las interrupciones habilitadas. Si hay lugar, el último informe
+ * corresponde al sistema operativo, cuyo tiempo de procesador es el tiempo ocioso.
+ *
+ * @param   informes    Arreglo donde se guardan los informes
+ * @param   cantidad    Cantidad de elementos del arreglo, hasta TASK_COUNT + 1
+ * @return  int         Cantidad de informes guardados
+ */
+int EstadoSistema(tarea_informe_t * informes, int cantidad);
+
+/**
+ * @brief Función para esperar una notificación dirigida a la tarea activa
+ *
+ * Si la tarea no recibió una notificación desde la última espera queda bloqueada, sin consumir
+ * tiempo de procesador, hasta que otra tarea o una interrupción la notifique.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ */
+void TareaEsperarNotificacion(void);
+
+/**
+ * @brief Función para notificar a una tarea
+ *
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción. Las
+ * notificaciones no se acumulan, por lo que la tarea debe verificar la condición que espera.
+ *
+ * @param   id      Numero de la tarea que se notifica
+ */
+void TareaNotificar(int id);
+
+/**
+ * @brief Metodo para crear un semaforo contador
+ *
+ * @param   inicial     Valor inicial de la cuenta del semaforo
+ * @return  semaforo_t  Puntero al descriptor del semaforo creado
+ */
+semaforo_t SemaforoCrear(uint32_t inicial);
+
+/**
+ * @brief Metodo para devolver un semaforo que ya no se usa
+ *
+ * Permite deshacer una creación parcial de un objeto que usa varios semaforos. Ninguna tarea
+ * puede estar esperando el semaforo.
+ *
+ * @param   semaforo    Puntero al descriptor del semaforo, se ignora si es NULL
+ */
+void SemaforoDestruir(semaforo_t semaforo);
+
+/**
+ * @brief Metodo para tomar un semaforo
+ *
+ * Si la cuenta del semaforo es cero la tarea que llama queda bloqueada, sin consumir tiempo de
+ * procesador, hasta que otra tarea o una interrupción libere el semaforo.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   semaforo    Puntero al descriptor del semaforo
+ */
+void SemaforoTomar(semaforo_t semaforo);
+
+/**
+ * @brief Metodo para liberar un semaforo
+ *
+ * Incrementa la cuenta del semaforo y desbloquea a la primera tarea que lo estuviera esperando.
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   semaforo    Puntero al descriptor del semaforo
+ */
+void SemaforoLiberar(semaforo_t semaforo);
+
+/**
+ * @brief Metodo para tomar un semaforo sin bloquear
+ *
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   semaforo    Puntero al descriptor del semaforo
+ * @return  true        El semaforo se tomó
+ * @return  false       La cuenta del semaforo era cero
+ */
+bool SemaforoIntentarTomar(semaforo_t semaforo);
+
+/**
+ * @brief Metodo para crear una cola de punteros
+ *
+ * Las colas transportan referencias a los datos, nunca copias, por lo que el que envía un
+ * puntero le transfiere al que lo recibe la propiedad de los datos.
+ *
+ * Cada cola usa dos semaforos, por lo que falla si no quedan semaforos libres.
+ *
+ * @param   longitud    Cantidad máxima de elementos en la cola, hasta QUEUE_LENGTH
+ * @return  cola_t      Puntero al descriptor de la cola creada, o NULL si no hay recursos
+ */
+cola_t ColaCrear(uint8_t longitud);
+
+/**
+ * @brief Metodo para devolver una cola que ya no se usa, junto con sus semaforos
+ *
+ * Ninguna tarea puede estar esperando en la cola.
+ *
+ * @param   cola        Puntero al descriptor de la cola, se ignora si es NULL
+ */
+void ColaDestruir(cola_t cola);
+
+/**
+ * @brief Metodo para enviar un puntero a una cola
+ *
+ * Si la cola está llena la tarea que llama queda bloqueada hasta que otra tarea retire un
+ * elemento.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   cola        Puntero al descriptor de la cola
+ * @param   elemento    Puntero que se envía
+ */
+void ColaEnviar(cola_t cola, void * elemento);
+
+/**
+ * @brief Metodo para enviar un puntero a una cola sin bloquear
+ *
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   cola        Puntero al descriptor de la cola
+ * @param   elemento    Puntero que se envía
+ * @return  true        El puntero se agregó a la cola
+ * @return  false       La cola estaba llena
+ */
+bool ColaIntentarEnviar(cola_t cola, void * elemento);
+
+/**
+ * @brief Metodo para recibir un puntero de una cola
+ *
+ * Si la cola está vacía la tarea que llama queda bloqueada hasta que otra tarea o una
+ * interrupción envíe un elemento.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   cola        Puntero al descriptor de la cola
+ * @return  void *      Puntero más antiguo de la cola
+ */
+void * ColaRecibir(cola_t cola);
+
+/**
+ * @brief Metodo para recibir un puntero de una cola sin bloquear
+ *
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   cola        Puntero al descriptor de la cola
+ * @return  void *      Puntero más antiguo de la cola, o NULL si la cola estaba vacía
+ */
+void * ColaIntentarRecibir(cola_t cola);
+
+/**
+ * @brief Metodo para consultar la cantidad de elementos de una cola
+ *
+ * @param   cola        Puntero al descriptor de la cola
+ * @return  uint8_t     Cantidad de elementos almacenados en la cola
+ */
+uint8_t ColaCantidad(cola_t cola);
+
+/**
+ * @brief Metodo para crear un temporizador de un disparo
+ *
+ * @param   funcion     Función que se ejecuta al vencer el temporizador
+ * @param   datos       Puntero que se entrega a la función
+ * @return  temporizador_t  Puntero al descriptor del temporizador creado
+ */
+temporizador_t TemporizadorCrear(temporizador_funcion_t funcion, void * datos);
+
+/**
+ * @brief Metodo para devolver un temporizador que ya no se usa
+ *
+ * Si el temporizador estaba corriendo se detiene antes de liberar el descriptor.
+ *
+ * @param   temporizador    Puntero al descriptor del temporizador, se ignora si es NULL
+ */
+void TemporizadorDestruir(temporizador_t temporizador);
+
+/**
+ * @brief Metodo para iniciar un temporizador
+ *
+ * Si el temporizador ya estaba corriendo se reinicia con el nuevo tiempo. Puede llamarse desde
+ * una tarea o desde una rutina de servicio de interrupción.
+ *
+ * @param   temporizador    Puntero al descriptor del temporizador
+ * @param   ticks           Cantidad de ticks del sistema hasta el vencimiento
+ */
+void TemporizadorIniciar(temporizador_t temporizador, uint32_t ticks);
+
+/**
+ * @brief Metodo para iniciar un temporizador con una tolerancia en el vencimiento
+ *
+ * El temporizador puede vencer hasta holgura ticks más tarde de lo pedido, de manera que el
+ * núcleo pueda agrupar su vencimiento con el de otros temporizadores o demoras. Puede llamarse
+ * desde una tarea o desde una rutina de servicio de interrupción.
+ *
+ * @param   temporizador    Puntero al descriptor del temporizador
+ * @param   ticks           Cantidad mínima de ticks del sistema hasta el vencimiento
+ * @param   holgura         Cantidad máxima de ticks adicionales hasta el vencimiento
+ */
+void TemporizadorIniciarConHolgura(temporizador_t temporizador, uint32_t ticks, uint32_t holgura);
+
+/**
+ * @brief Metodo para detener un temporizador antes de su vencimiento
+ *
+ * @param   temporizador    Puntero al descriptor del temporizador
+ */
+void TemporizadorDetener(temporizador_t temporizador);
+
+/**
+ * @brief Función que indica un error en el cambio de contexto
+ *
+ * Es el punto de retorno de todas las tareas y debe ser provista por la aplicación
+ *
+ * @remark Esta funcion no debería ejecutarse nunca, solo se accede a la misma si las funciones
+ *         que implementan las tareas terminan
+ */
+void Error(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* KERNEL_H */
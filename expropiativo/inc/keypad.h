@@ -0,0 +1,149 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+/** \brief Matrix keypad declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad máxima de filas del teclado
+#ifndef KEYPAD_MAX_ROWS
+    #define KEYPAD_MAX_ROWS 4
+#endif
+
+//! Cantidad máxima de columnas del teclado
+#ifndef KEYPAD_MAX_COLUMNS
+    #define KEYPAD_MAX_COLUMNS 4
+#endif
+
+//! Cantidad de eventos que pueden estar pendientes de lectura
+#ifndef KEYPAD_QUEUE_LENGTH
+    #define KEYPAD_QUEUE_LENGTH 8
+#endif
+
+//! Tiempo en milisegundos entre dos barridos del teclado
+#ifndef KEYPAD_SCAN_PERIOD
+    #define KEYPAD_SCAN_PERIOD 5
+#endif
+
+//! Cantidad de barridos consecutivos con el mismo estado para aceptar un cambio de una tecla
+#ifndef KEYPAD_DEBOUNCE_SCANS
+    #define KEYPAD_DEBOUNCE_SCANS 4
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar el teclado
+typedef struct keypad_s * keypad_t;
+
+//! Terminal GPIO de una fila o columna del teclado
+typedef struct keypad_pin_s {
+    uint8_t port;   //!< Puerto GPIO del terminal
+    uint8_t pin;    //!< Terminal del puerto GPIO
+} keypad_pin_t;
+
+//! Evento generado al presionar o soltar una tecla
+typedef struct keypad_event_s {
+    uint8_t key;    //!< Numero de la tecla, fila * columnas + columna
+    bool pressed;   //!< La tecla se presionó, o se soltó si es falso
+} keypad_event_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear el teclado matricial
+ *
+ * Las filas se crean como entradas digitales invertidas y las columnas como salidas digitales.
+ * Mientras no hay teclas presionadas todas las columnas quedan en bajo y el teclado espera en la
+ * interrupción de grupo GINT0 sin consumir tiempo de procesador. Al presionar una tecla la
+ * interrupción arranca el barrido periódico, que se detiene cuando se sueltan todas las teclas.
+ *
+ * @remark Los terminales deben configurarse previamente como GPIO, con las filas en pull-up
+ *
+ * @param   rows        Terminales GPIO de las filas
+ * @param   row_count   Cantidad de filas, hasta KEYPAD_MAX_ROWS
+ * @param   columns     Terminales GPIO de las columnas
+ * @param   column_count Cantidad de columnas, hasta KEYPAD_MAX_COLUMNS
+ * @return  keypad_t    Puntero al descriptor del teclado, o NULL si no se pudo crear
+ */
+keypad_t KeypadCreate(const keypad_pin_t * rows, uint8_t row_count, const keypad_pin_t * columns,
+                      uint8_t column_count);
+
+/**
+ * @brief Metodo para esperar el siguiente evento del teclado
+ *
+ * La tarea que llama queda bloqueada, sin consumir tiempo de procesador, hasta que se presiona o
+ * se suelta una tecla.
+ *
+ * @param   keypad          Puntero al descriptor del teclado
+ * @return  keypad_event_t  Evento más antiguo de la cola
+ */
+keypad_event_t KeypadRead(keypad_t keypad);
+
+/**
+ * @brief Metodo para obtener la cantidad de eventos descartados por tener la cola llena
+ *
+ * @param   keypad      Puntero al descriptor del teclado
+ * @return  uint32_t    Cantidad de eventos descartados desde la creación del teclado
+ */
+uint32_t KeypadOverruns(keypad_t keypad);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* KEYPAD_H */
@@ -0,0 +1,144 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+/** \brief Streaming data logger declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "sdcard.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de buffers en memoria, uno se llena mientras los otros se escriben en la tarjeta
+#ifndef LOGGER_BUFFERS
+    #define LOGGER_BUFFERS 2
+#endif
+
+//! Cantidad de bloques de la tarjeta de cada buffer, escritos en una sola operación
+#ifndef LOGGER_BUFFER_BLOCKS
+    #define LOGGER_BUFFER_BLOCKS 4
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar el registro de datos
+typedef struct logger_s * logger_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear el registro de datos sobre una zona contigua de la tarjeta
+ *
+ * La zona debe estar reservada de antemano, por ejemplo como un archivo contiguo creado al
+ * formatear la tarjeta, y se escribe en orden desde su primer bloque. Los datos los escribe la
+ * tarea LoggerTask, que debe crearse con CrearTarea.
+ *
+ * @param   card        Puntero al descriptor de la tarjeta
+ * @param   first       Numero del primer bloque de la zona
+ * @param   count       Cantidad de bloques de la zona
+ * @return  logger_t    Puntero al descriptor del registro, o NULL si ya fue creado
+ */
+logger_t LoggerCreate(sd_card_t card, uint32_t first, uint32_t count);
+
+/**
+ * @brief Metodo para agregar datos al registro sin esperar a la tarjeta
+ *
+ * El lugar se reserva con las interrupciones deshabilitadas y los datos se copian después con las
+ * interrupciones habilitadas. Cada buffer se entrega a la tarea de escritura, en orden, cuando
+ * terminaron todas las copias que lo completan. Nunca bloquea, por lo que puede llamarse desde
+ * una tarea o desde una rutina de servicio de interrupción. Si no hay lugar en los buffers los
+ * datos se descartan completos.
+ *
+ * @param   logger      Puntero al descriptor del registro
+ * @param   data        Datos a agregar
+ * @param   length      Cantidad de bytes a agregar
+ * @return  true        Los datos se agregaron al registro
+ * @return  false       Los datos se descartaron por falta de lugar
+ */
+bool LoggerWrite(logger_t logger, const void * data, uint16_t length);
+
+/**
+ * @brief Metodo para entregar a la tarea de escritura el buffer que se está llenando
+ *
+ * El resto del buffer se completa con ceros.
+ *
+ * @param   logger      Puntero al descriptor del registro
+ */
+void LoggerFlush(logger_t logger);
+
+/**
+ * @brief Metodo para obtener la cantidad de bytes descartados por falta de lugar
+ *
+ * @param   logger      Puntero al descriptor del registro
+ * @return  uint32_t    Cantidad de bytes descartados desde la creación del registro
+ */
+uint32_t LoggerDropped(logger_t logger);
+
+/**
+ * @brief Tarea que escribe en la tarjeta los buffers completos
+ *
+ * Abre una escritura de varios bloques cuando hay un buffer completo y le agrega todos los buffers
+ * que se completen mientras tanto, de manera que la tarjeta programa los bloques en forma
+ * secuencial. Al vaciarse la cola cierra la escritura, con lo que la tarjeta libera el bus SPI
+ * para otros dispositivos entre ráfagas. Al llegar al final de la zona descarta los datos
+ * siguientes.
+ */
+void LoggerTask(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LOGGER_H */
@@ -0,0 +1,167 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+/** \brief Producer/consumer pipeline declarations
+ **
+ ** Una cadena de procesamiento se declara como una tabla constante de etapas. Cada etapa se
+ ** ejecuta en su propia tarea y recibe los elementos por una cola acotada, los procesa en lotes y
+ ** los entrega a la cola de la etapa siguiente. Cuando una cola se llena el productor queda
+ ** bloqueado, de manera que nunca se descartan datos, y los contadores de cada etapa muestran en
+ ** que punto de la cadena se acumulan los elementos.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "kernel.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de cadenas de procesamiento disponibles en el sistema
+#ifndef PIPELINE_INSTANCES
+    #define PIPELINE_INSTANCES 2
+#endif
+
+//! Cantidad máxima de etapas de una cadena de procesamiento
+#ifndef PIPELINE_STAGES
+    #define PIPELINE_STAGES 4
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar una cadena de procesamiento
+typedef struct pipeline_s * pipeline_t;
+
+/**
+ * @brief Función que procesa un lote de elementos en una etapa
+ *
+ * Los elementos se procesan en el lugar y los que quedan en el arreglo se entregan a la etapa
+ * siguiente. Para retener o descartar un elemento la función debe reemplazarlo por NULL, y en la
+ * última etapa debe liberar todos los elementos que recibe.
+ *
+ * @param   items       Arreglo con los elementos del lote
+ * @param   count       Cantidad de elementos del lote
+ * @param   context     Datos de la etapa definidos en su declaración
+ */
+typedef void (*pipeline_function_t)(void * items[], uint8_t count, void * context);
+
+//! Estructura con la declaración de una etapa de procesamiento
+typedef struct pipeline_stage_s {
+    int task;                     //!< Tarea que ejecuta la etapa, con PipelineTask como entrada
+    pipeline_function_t function; //!< Función que procesa los lotes de la etapa
+    void * context;               //!< Datos que se entregan a la función en cada lote
+    uint8_t depth;                //!< Longitud de la cola de entrada, hasta QUEUE_LENGTH
+    uint8_t batch;                //!< Cantidad máxima de elementos por lote, hasta QUEUE_LENGTH
+} pipeline_stage_t;
+
+//! Estructura con los contadores de una etapa de procesamiento
+typedef struct pipeline_statistics_s {
+    uint32_t items;   //!< Cantidad de elementos procesados
+    uint32_t batches; //!< Cantidad de lotes procesados
+    uint32_t stalls;  //!< Cantidad de veces que un productor se bloqueó con la cola llena
+    uint8_t depth;    //!< Cantidad actual de elementos en la cola de entrada
+    uint8_t peak;     //!< Cantidad máxima de elementos observada en la cola de entrada
+} pipeline_statistics_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear una cadena de procesamiento
+ *
+ * Crea la cola de entrada de cada etapa. Las tareas de las etapas deben crearse aparte, con
+ * PipelineTask como función de entrada, antes de arrancar el sistema.
+ *
+ * @param   stages      Tabla con la declaración de las etapas, en el orden de procesamiento
+ * @param   count       Cantidad de etapas de la tabla, hasta PIPELINE_STAGES
+ * @return  pipeline_t  Puntero al descriptor de la cadena creada, o NULL si no hay recursos
+ */
+pipeline_t PipelineCreate(const pipeline_stage_t * stages, uint8_t count);
+
+/**
+ * @brief Metodo para entregar un elemento a la primera etapa de una cadena
+ *
+ * Si la cola de entrada está llena la tarea queda bloqueada hasta que la etapa retire elementos.
+ * El elemento, normalmente un buffer de un pool, pasa a pertenecer a la cadena.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   pipeline    Puntero al descriptor de la cadena
+ * @param   item        Elemento a procesar, distinto de NULL
+ */
+void PipelineSubmit(pipeline_t pipeline, void * item);
+
+/**
+ * @brief Metodo para consultar los contadores de una etapa
+ *
+ * @param   pipeline    Puntero al descriptor de la cadena
+ * @param   stage       Numero de la etapa, empezando en cero
+ * @param   statistics  Estructura donde se copian los contadores de la etapa
+ * @return  true        Se copiaron los contadores
+ * @return  false       La etapa no existe en la cadena
+ */
+bool PipelineStatistics(pipeline_t pipeline, uint8_t stage, pipeline_statistics_t * statistics);
+
+/**
+ * @brief Función de entrada común a las tareas de todas las etapas
+ *
+ * Busca la etapa declarada para la tarea actual y la ejecuta indefinidamente: espera el primer
+ * elemento, retira sin esperar hasta completar el lote, lo procesa y entrega el resultado a la
+ * etapa siguiente.
+ */
+void PipelineTask(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* PIPELINE_H */
@@ -0,0 +1,146 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PONCHO_H
+#define PONCHO_H
+
+/** \brief Expansion board hardware abstraction declarations
+ **
+ ** Terminales del poncho de expansión con la pantalla de siete segmentos multiplexada. Los
+ ** segmentos a hasta g ocupan los bits 0 a 6 de un mismo puerto GPIO, de manera que un digito
+ ** completo se escribe en una sola operación sobre el puerto.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "chip.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define SEGMENT_A_PORT 4
+#define SEGMENT_A_PIN 0
+#define SEGMENT_A_FUNC SCU_MODE_FUNC0
+#define SEGMENT_A_GPIO 2
+#define SEGMENT_A_BIT 0
+
+#define SEGMENT_B_PORT 4
+#define SEGMENT_B_PIN 1
+#define SEGMENT_B_FUNC SCU_MODE_FUNC0
+#define SEGMENT_B_GPIO 2
+#define SEGMENT_B_BIT 1
+
+#define SEGMENT_C_PORT 4
+#define SEGMENT_C_PIN 2
+#define SEGMENT_C_FUNC SCU_MODE_FUNC0
+#define SEGMENT_C_GPIO 2
+#define SEGMENT_C_BIT 2
+
+#define SEGMENT_D_PORT 4
+#define SEGMENT_D_PIN 3
+#define SEGMENT_D_FUNC SCU_MODE_FUNC0
+#define SEGMENT_D_GPIO 2
+#define SEGMENT_D_BIT 3
+
+#define SEGMENT_E_PORT 4
+#define SEGMENT_E_PIN 4
+#define SEGMENT_E_FUNC SCU_MODE_FUNC0
+#define SEGMENT_E_GPIO 2
+#define SEGMENT_E_BIT 4
+
+#define SEGMENT_F_PORT 4
+#define SEGMENT_F_PIN 5
+#define SEGMENT_F_FUNC SCU_MODE_FUNC0
+#define SEGMENT_F_GPIO 2
+#define SEGMENT_F_BIT 5
+
+#define SEGMENT_G_PORT 4
+#define SEGMENT_G_PIN 6
+#define SEGMENT_G_FUNC SCU_MODE_FUNC0
+#define SEGMENT_G_GPIO 2
+#define SEGMENT_G_BIT 6
+
+#define SEGMENT_P_PORT 6
+#define SEGMENT_P_PIN 8
+#define SEGMENT_P_FUNC SCU_MODE_FUNC4
+#define SEGMENT_P_GPIO 5
+#define SEGMENT_P_BIT 16
+
+#define DIGIT_1_PORT 0
+#define DIGIT_1_PIN 0
+#define DIGIT_1_FUNC SCU_MODE_FUNC0
+#define DIGIT_1_GPIO 0
+#define DIGIT_1_BIT 0
+
+#define DIGIT_2_PORT 0
+#define DIGIT_2_PIN 1
+#define DIGIT_2_FUNC SCU_MODE_FUNC0
+#define DIGIT_2_GPIO 0
+#define DIGIT_2_BIT 1
+
+#define DIGIT_3_PORT 1
+#define DIGIT_3_PIN 15
+#define DIGIT_3_FUNC SCU_MODE_FUNC0
+#define DIGIT_3_GPIO 0
+#define DIGIT_3_BIT 2
+
+#define DIGIT_4_PORT 1
+#define DIGIT_4_PIN 17
+#define DIGIT_4_FUNC SCU_MODE_FUNC0
+#define DIGIT_4_GPIO 0
+#define DIGIT_4_BIT 3
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* PONCHO_H */
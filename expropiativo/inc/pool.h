@@ -0,0 +1,190 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+/** \brief Zero-copy buffer pool declarations
+ **
+ ** Los buffers de tamaño fijo se toman de un pool y pasan de una etapa a otra por referencia, a
+ ** través de las colas del kernel, sin copiar nunca los datos. Cada buffer lleva una cuenta de
+ ** referencias: el que lo envía por una cola le transfiere su referencia al que lo recibe, y el
+ ** buffer vuelve al pool cuando la última etapa que lo usa lo libera.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de pools de buffers disponibles en el sistema
+#ifndef BUFFER_POOL_INSTANCES
+    #define BUFFER_POOL_INSTANCES 4
+#endif
+
+//! Cantidad total de descriptores de buffers, compartidos entre todos los pools
+#ifndef BUFFER_INSTANCES
+    #define BUFFER_INSTANCES 32
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar un pool de buffers
+typedef struct buffer_pool_s * buffer_pool_t;
+
+//! Referencia a un descriptor para gestionar un buffer
+typedef struct buffer_s * buffer_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear un pool de buffers de tamaño fijo
+ *
+ * La memoria de los buffers la entrega la aplicación, normalmente un arreglo estático, y se
+ * divide en count buffers consecutivos de size bytes cada uno.
+ *
+ * @param   memory          Memoria para los datos de los buffers, de al menos size * count bytes
+ * @param   size            Cantidad de bytes de cada buffer
+ * @param   count           Cantidad de buffers del pool
+ * @return  buffer_pool_t   Puntero al descriptor del pool creado o NULL si no hay recursos
+ */
+buffer_pool_t BufferPoolCreate(void * memory, uint16_t size, uint16_t count);
+
+/**
+ * @brief Metodo para consultar la cantidad de buffers libres de un pool
+ *
+ * @param   pool        Puntero al descriptor del pool
+ * @return  uint16_t    Cantidad de buffers libres
+ */
+uint16_t BufferPoolAvailable(buffer_pool_t pool);
+
+/**
+ * @brief Metodo para tomar un buffer de un pool
+ *
+ * Si no hay buffers libres la tarea queda bloqueada hasta que alguna etapa libere uno. El buffer
+ * se entrega con una referencia, que pertenece a quien lo toma, y con longitud cero.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   pool        Puntero al descriptor del pool
+ * @return  buffer_t    Puntero al descriptor del buffer
+ */
+buffer_t BufferAllocate(buffer_pool_t pool);
+
+/**
+ * @brief Metodo para tomar un buffer de un pool sin bloquear
+ *
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   pool        Puntero al descriptor del pool
+ * @return  buffer_t    Puntero al descriptor del buffer o NULL si no hay buffers libres
+ */
+buffer_t BufferTryAllocate(buffer_pool_t pool);
+
+/**
+ * @brief Metodo para agregar una referencia a un buffer
+ *
+ * Se usa cuando el mismo buffer se entrega a más de una etapa, cada una de las cuales debe
+ * liberarlo al terminar. Puede llamarse desde una interrupción.
+ *
+ * @param   buffer      Puntero al descriptor del buffer
+ */
+void BufferRetain(buffer_t buffer);
+
+/**
+ * @brief Metodo para liberar una referencia a un buffer
+ *
+ * Cuando se libera la última referencia el buffer vuelve al pool y se despierta a una tarea que
+ * estuviera esperando uno. Puede llamarse desde una interrupción.
+ *
+ * @param   buffer      Puntero al descriptor del buffer
+ */
+void BufferRelease(buffer_t buffer);
+
+/**
+ * @brief Metodo para acceder a los datos de un buffer
+ *
+ * Las etapas procesan los datos en el lugar, sobre esta misma memoria.
+ *
+ * @param   buffer      Puntero al descriptor del buffer
+ * @return  void *      Puntero al primer byte de datos del buffer
+ */
+void * BufferData(buffer_t buffer);
+
+/**
+ * @brief Metodo para consultar la capacidad de un buffer
+ *
+ * @param   buffer      Puntero al descriptor del buffer
+ * @return  uint16_t    Cantidad de bytes que puede almacenar el buffer
+ */
+uint16_t BufferSize(buffer_t buffer);
+
+/**
+ * @brief Metodo para consultar la cantidad de bytes válidos de un buffer
+ *
+ * @param   buffer      Puntero al descriptor del buffer
+ * @return  uint16_t    Cantidad de bytes válidos
+ */
+uint16_t BufferLength(buffer_t buffer);
+
+/**
+ * @brief Metodo para fijar la cantidad de bytes válidos de un buffer
+ *
+ * @param   buffer      Puntero al descriptor del buffer
+ * @param   length      Cantidad de bytes válidos, que se limita a la capacidad del buffer
+ */
+void BufferSetLength(buffer_t buffer, uint16_t length);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* POOL_H */
@@ -0,0 +1,161 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+/** \brief COBS framed serial protocol declarations
+ **
+ ** Cada mensaje se transmite codificado con COBS, seguido de su suma CRC-16/CCITT-FALSE en dos
+ ** bytes con el más significativo primero, y terminado con un byte cero como delimitador.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de bytes del buffer circular en el que el DMA deja los datos recibidos
+#ifndef PROTOCOL_RING_SIZE
+    #define PROTOCOL_RING_SIZE 1024
+#endif
+
+//! Cantidad máxima de bytes de un mensaje, sin codificar y sin la suma de verificación
+#ifndef PROTOCOL_MAX_MESSAGE
+    #define PROTOCOL_MAX_MESSAGE 250
+#endif
+
+//! Cantidad de mensajes recibidos que pueden estar pendientes de lectura
+#ifndef PROTOCOL_QUEUE_LENGTH
+    #define PROTOCOL_QUEUE_LENGTH 8
+#endif
+
+//! Tiempo en milisegundos entre dos búsquedas de delimitadores en los datos recibidos
+#ifndef PROTOCOL_POLL_PERIOD
+    #define PROTOCOL_POLL_PERIOD 1
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar el protocolo
+typedef struct protocol_s * protocol_t;
+
+//! Mensaje recibido, referenciado dentro del buffer de recepción sin copiarlo
+typedef struct protocol_message_s {
+    uint8_t * data;      //!< Contenido decodificado del mensaje
+    uint16_t length;     //!< Cantidad de bytes del mensaje
+    uint32_t position;   //!< Posición del mensaje en el flujo recibido, para uso interno
+} protocol_message_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear el protocolo sobre la UART del puerto USB de la placa
+ *
+ * La recepción se realiza por DMA sobre un buffer circular que nunca se detiene, sin ninguna
+ * interrupción por byte. Un temporizador del núcleo busca los delimitadores en los datos nuevos y
+ * encola la posición de cada trama completa.
+ *
+ * @param   baudrate    Velocidad de la comunicación en bits por segundo
+ * @return  protocol_t  Puntero al descriptor del protocolo, o NULL si no se pudo crear
+ */
+protocol_t ProtocolCreate(uint32_t baudrate);
+
+/**
+ * @brief Metodo para esperar el siguiente mensaje valido
+ *
+ * La trama se decodifica en el mismo lugar del buffer de recepción y se verifica su suma. Las
+ * tramas con errores se descartan y se cuentan. La tarea que llama queda bloqueada, sin consumir
+ * tiempo de procesador, hasta que llega un mensaje valido.
+ *
+ * @param   protocol    Puntero al descriptor del protocolo
+ * @param   message     Referencia al mensaje recibido
+ */
+void ProtocolReceive(protocol_t protocol, protocol_message_t * message);
+
+/**
+ * @brief Metodo para liberar un mensaje recibido
+ *
+ * El buffer de recepción no detiene al DMA, por lo que un mensaje que se retiene demasiado
+ * tiempo puede quedar sobrescrito por los datos siguientes. El resultado indica si el contenido
+ * del mensaje se mantuvo valido durante todo su uso.
+ *
+ * @param   protocol    Puntero al descriptor del protocolo
+ * @param   message     Referencia al mensaje recibido
+ * @return  true        El mensaje no fue sobrescrito mientras se usaba
+ * @return  false       El mensaje fue sobrescrito y su contenido no es confiable
+ */
+bool ProtocolRelease(protocol_t protocol, const protocol_message_t * message);
+
+/**
+ * @brief Metodo para transmitir un mensaje y esperar a que termine
+ *
+ * @param   protocol    Puntero al descriptor del protocolo
+ * @param   data        Contenido del mensaje
+ * @param   length      Cantidad de bytes del mensaje, hasta PROTOCOL_MAX_MESSAGE
+ * @return  true        El mensaje se transmitió correctamente
+ * @return  false       El mensaje es demasiado largo o falló el DMA
+ */
+bool ProtocolSend(protocol_t protocol, const void * data, uint16_t length);
+
+/**
+ * @brief Metodo para obtener la cantidad de tramas recibidas descartadas
+ *
+ * @param   protocol    Puntero al descriptor del protocolo
+ * @return  uint32_t    Tramas descartadas por errores de codificación, suma o desborde
+ */
+uint32_t ProtocolErrors(protocol_t protocol);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* PROTOCOL_H */
@@ -0,0 +1,147 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SDCARD_H
+#define SDCARD_H
+
+/** \brief SD card over SPI declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "spi.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de bytes de un bloque de la tarjeta
+#define SD_BLOCK_SIZE 512
+
+//! Cantidad de tarjetas que se pueden conectar al bus
+#ifndef SD_CARD_INSTANCES
+    #define SD_CARD_INSTANCES 1
+#endif
+
+//! Frecuencia de reloj del bus en Hz después de la inicialización
+#ifndef SD_CARD_BITRATE
+    #define SD_CARD_BITRATE 20000000
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar una tarjeta SD
+typedef struct sd_card_s * sd_card_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear e inicializar una tarjeta SD conectada al bus SPI de la placa
+ *
+ * Realiza la secuencia de inicialización en modo SPI a 400 KHz y luego pasa a SD_CARD_BITRATE.
+ * Soporta tarjetas SDSC y SDHC/SDXC, direccionando siempre por numero de bloque.
+ *
+ * @remark Solo puede llamarse desde una tarea
+ *
+ * @param   select      Terminal de selección de la tarjeta
+ * @return  sd_card_t   Puntero al descriptor de la tarjeta, o NULL si no respondió
+ */
+sd_card_t SdCardCreate(const spi_select_t * select);
+
+/**
+ * @brief Metodo para leer un bloque de la tarjeta
+ *
+ * @param   card        Puntero al descriptor de la tarjeta
+ * @param   block       Numero del bloque
+ * @param   data        Espacio para los SD_BLOCK_SIZE bytes del bloque
+ * @return  true        El bloque se leyó correctamente
+ * @return  false       La tarjeta rechazó el comando o no respondió
+ */
+bool SdCardRead(sd_card_t card, uint32_t block, uint8_t * data);
+
+/**
+ * @brief Metodo para empezar una escritura de varios bloques consecutivos
+ *
+ * Mientras la escritura está abierta la tarjeta queda seleccionada y no se puede usar el bus
+ * para otros dispositivos.
+ *
+ * @param   card        Puntero al descriptor de la tarjeta
+ * @param   block       Numero del primer bloque a escribir
+ * @return  true        La tarjeta aceptó la escritura
+ * @return  false       La tarjeta rechazó el comando o no respondió
+ */
+bool SdCardWriteStart(sd_card_t card, uint32_t block);
+
+/**
+ * @brief Metodo para escribir bloques a continuación de los anteriores de la escritura abierta
+ *
+ * Los datos de cada bloque se transfieren por DMA directamente desde la memoria del llamador.
+ *
+ * @param   card        Puntero al descriptor de la tarjeta
+ * @param   data        Datos a escribir, count * SD_BLOCK_SIZE bytes
+ * @param   count       Cantidad de bloques
+ * @return  true        Todos los bloques se escribieron correctamente
+ * @return  false       La tarjeta rechazó algún bloque o no respondió
+ */
+bool SdCardWriteBlocks(sd_card_t card, const uint8_t * data, uint16_t count);
+
+/**
+ * @brief Metodo para terminar la escritura abierta y liberar el bus
+ *
+ * @param   card        Puntero al descriptor de la tarjeta
+ * @return  true        La tarjeta terminó de programar los bloques
+ * @return  false       La tarjeta no respondió
+ */
+bool SdCardWriteStop(sd_card_t card);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SDCARD_H */
@@ -0,0 +1,214 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+/** \brief Cortex-M4 SIMD instructions declarations
+ **
+ ** Cuando se compila para el Cortex-M4 las instrucciones se toman de las funciones intrínsecas de
+ ** CMSIS. Para cualquier otro procesador se emulan en C con el mismo resultado, de manera que los
+ ** núcleos de cálculo puedan verificarse en el equipo de desarrollo.
+ **
+ ** \addtogroup dsp DSP
+ ** \brief Procesamiento digital de señales
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP)
+    #include "chip.h"
+#else
+    #include <time.h>
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#if defined(__ARM_FEATURE_DSP)
+    //! Habilita el contador de ciclos del procesador
+    #define BENCHMARK_INIT()                                                                       \
+        do {                                                                                       \
+            CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;                                        \
+            DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                                                   \
+        } while (0)
+
+    //! Lectura del contador de ciclos del procesador
+    #define BENCHMARK_NOW() (DWT->CYCCNT)
+
+    //! Cantidad de bloques de cada medición, el contador de ciclos resuelve un solo bloque
+    #define BENCHMARK_ITERATIONS 1
+#else
+    //! En el equipo de desarrollo no hace falta habilitar el reloj
+    #define BENCHMARK_INIT()
+
+    //! Lectura del reloj de la biblioteca estándar
+    #define BENCHMARK_NOW() ((uint32_t)clock())
+
+    //! Cantidad de bloques de cada medición, suficientes para que el reloj avance varios ticks
+    #define BENCHMARK_ITERATIONS 20000
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+#if !defined(__ARM_FEATURE_DSP)
+//! Emulación de la instrucción SSAT
+static inline int32_t __SSAT(int32_t value, uint32_t bits) {
+    int32_t maximum = (1 << (bits - 1)) - 1;
+
+    if (value > maximum) {
+        value = maximum;
+    } else if (value < -maximum - 1) {
+        value = -maximum - 1;
+    }
+    return value;
+}
+
+//! Emulación de la instrucción SMLAD
+static inline uint32_t __SMLAD(uint32_t x, uint32_t y, uint32_t sum) {
+    return sum + (int16_t)x * (int16_t)y + (int16_t)(x >> 16) * (int16_t)(y >> 16);
+}
+
+//! Emulación de la instrucción SMLALD
+static inline uint64_t __SMLALD(uint32_t x, uint32_t y, uint64_t sum) {
+    return sum + (int64_t)((int16_t)x * (int16_t)y) +
+           (int64_t)((int16_t)(x >> 16) * (int16_t)(y >> 16));
+}
+
+//! Emulación de la instrucción SMUAD
+static inline uint32_t __SMUAD(uint32_t x, uint32_t y) {
+    return (int16_t)x * (int16_t)y + (int16_t)(x >> 16) * (int16_t)(y >> 16);
+}
+
+//! Emulación de la instrucción SMUSDX
+static inline uint32_t __SMUSDX(uint32_t x, uint32_t y) {
+    return (int16_t)x * (int16_t)(y >> 16) - (int16_t)(x >> 16) * (int16_t)y;
+}
+
+//! Emulación de la instrucción PKHBT
+static inline uint32_t __PKHBT(uint32_t bottom, uint32_t top, uint32_t shift) {
+    return (bottom & 0x0000FFFF) | ((top << shift) & 0xFFFF0000);
+}
+
+//! Combina dos resultados de 16 bits en una palabra
+static inline uint32_t SimdPack(int32_t bottom, int32_t top) {
+    return ((uint32_t)(uint16_t)top << 16) | (uint16_t)bottom;
+}
+
+//! Emulación de la instrucción QADD16
+static inline uint32_t __QADD16(uint32_t x, uint32_t y) {
+    return SimdPack(__SSAT((int16_t)x + (int16_t)y, 16),
+                    __SSAT((int16_t)(x >> 16) + (int16_t)(y >> 16), 16));
+}
+
+//! Emulación de la instrucción QSUB16
+static inline uint32_t __QSUB16(uint32_t x, uint32_t y) {
+    return SimdPack(__SSAT((int16_t)x - (int16_t)y, 16),
+                    __SSAT((int16_t)(x >> 16) - (int16_t)(y >> 16), 16));
+}
+
+//! Emulación de la instrucción SHADD16
+static inline uint32_t __SHADD16(uint32_t x, uint32_t y) {
+    return SimdPack(((int16_t)x + (int16_t)y) >> 1,
+                    ((int16_t)(x >> 16) + (int16_t)(y >> 16)) >> 1);
+}
+
+//! Emulación de la instrucción SHSUB16
+static inline uint32_t __SHSUB16(uint32_t x, uint32_t y) {
+    return SimdPack(((int16_t)x - (int16_t)y) >> 1,
+                    ((int16_t)(x >> 16) - (int16_t)(y >> 16)) >> 1);
+}
+
+//! Emulación de la instrucción SHASX
+static inline uint32_t __SHASX(uint32_t x, uint32_t y) {
+    return SimdPack(((int16_t)x - (int16_t)(y >> 16)) >> 1,
+                    ((int16_t)(x >> 16) + (int16_t)y) >> 1);
+}
+
+//! Emulación de la instrucción SHSAX
+static inline uint32_t __SHSAX(uint32_t x, uint32_t y) {
+    return SimdPack(((int16_t)x + (int16_t)(y >> 16)) >> 1,
+                    ((int16_t)(x >> 16) - (int16_t)y) >> 1);
+}
+
+//! Emulación de la instrucción RBIT
+static inline uint32_t __RBIT(uint32_t value) {
+    uint32_t result = 0;
+
+    for (int bit = 0; bit < 32; bit++) {
+        result = (result << 1) | ((value >> bit) & 1);
+    }
+    return result;
+}
+
+//! Emulación de la instrucción CLZ
+static inline uint32_t __CLZ(uint32_t value) {
+    return value ? __builtin_clz(value) : 32;
+}
+#endif
+
+//! Lee dos muestras de 16 bits consecutivas, sin importar su alineación
+static inline uint32_t SimdReadPair(const int16_t * pointer) {
+    uint32_t value;
+
+    memcpy(&value, pointer, sizeof(value));
+    return value;
+}
+
+//! Escribe dos muestras de 16 bits consecutivas, sin importar su alineación
+static inline void SimdWritePair(int16_t * pointer, uint32_t value) {
+    memcpy(pointer, &value, sizeof(value));
+}
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SIMD_H */
@@ -0,0 +1,192 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SPI_H
+#define SPI_H
+
+/** \brief Asynchronous SPI master declarations
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de transacciones que pueden estar pendientes en el bus
+#ifndef SPI_QUEUE_LENGTH
+    #define SPI_QUEUE_LENGTH 8
+#endif
+
+//! Cantidad de dispositivos que se pueden conectar al bus
+#ifndef SPI_DEVICE_INSTANCES
+    #define SPI_DEVICE_INSTANCES 4
+#endif
+
+//! Cantidad máxima de bytes de una transacción, limitada por el controlador de DMA
+#define SPI_MAX_LENGTH 4095
+
+/**
+ * @brief Inicializa una transacción simple, con el dispositivo seleccionado solo durante la misma
+ *
+ * Las banderas unselected y hold quedan en falso, por lo que una transacción inicializada así
+ * no altera el manejo de la selección. Por ejemplo:
+ * struct spi_transfer_s transfer = SPI_TRANSFER(device, command, response, sizeof(command));
+ */
+#define SPI_TRANSFER(device_, tx_, rx_, length_)                                                   \
+    ((struct spi_transfer_s){.device = (device_), .tx = (tx_), .rx = (rx_), .length = (length_)})
+
+/* === Public data type declarations =========================================================== */
+
+//! Referencia a un descriptor para gestionar un dispositivo conectado al bus SPI
+typedef struct spi_device_s * spi_device_t;
+
+//! Terminal de selección de un dispositivo, con su ubicación en el SCU y en el GPIO
+typedef struct spi_select_s {
+    uint8_t scu_port;   //!< Grupo del terminal en el SCU
+    uint8_t scu_pin;    //!< Numero del terminal dentro del grupo del SCU
+    uint16_t function;  //!< Función del SCU que conecta el terminal al GPIO
+    uint8_t port;       //!< Puerto GPIO del terminal
+    uint8_t pin;        //!< Terminal del puerto GPIO
+} spi_select_t;
+
+/**
+ * @brief Transacción sobre el bus SPI, la memoria es provista por la tarea que la solicita
+ *
+ * Todos los campos que no se usan deben quedar en cero, ya que las banderas unselected y hold
+ * cambian el manejo de la selección del dispositivo. Conviene inicializarla con SPI_TRANSFER o
+ * con un inicializador designado.
+ */
+typedef struct spi_transfer_s {
+    spi_device_t device;   //!< Dispositivo con el que se realiza la transacción
+    const uint8_t * tx;    //!< Datos a transmitir, o NULL para transmitir 0xFF
+    uint8_t * rx;          //!< Espacio para los datos recibidos, o NULL para descartarlos
+    uint16_t length;       //!< Cantidad de bytes de la transacción
+    bool unselected;       //!< La transacción se realiza sin seleccionar al dispositivo
+    bool hold;             //!< El dispositivo sigue seleccionado al terminar la transacción
+    volatile bool done;    //!< Bandera que indica que la transacción terminó
+    volatile bool error;   //!< Bandera que indica que la transacción terminó con un error
+} * spi_transfer_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear un dispositivo conectado al bus SPI de la placa
+ *
+ * La primera llamada configura el controlador SSP1 y los terminales del conector de la placa.
+ * El terminal de selección del dispositivo se conecta al GPIO en el SCU y se maneja como una
+ * salida digital activa en bajo.
+ *
+ * @param   select          Terminal de selección del dispositivo
+ * @param   mode            Modo SPI del dispositivo, de 0 a 3
+ * @param   bitrate         Frecuencia de reloj del bus para el dispositivo en Hz
+ * @return  spi_device_t    Puntero al descriptor del dispositivo creado, o NULL si no hay recursos
+ */
+spi_device_t SpiDeviceCreate(const spi_select_t * select, uint8_t mode, uint32_t bitrate);
+
+/**
+ * @brief Metodo para liberar un dispositivo del bus SPI
+ *
+ * El terminal de selección queda configurado como salida en alto, porque otro descriptor puede
+ * compartirlo. El dispositivo no debe tener transacciones pendientes.
+ *
+ * @param   device          Puntero al descriptor del dispositivo, se ignora si es NULL
+ */
+void SpiDeviceDestroy(spi_device_t device);
+
+/**
+ * @brief Metodo para encolar una transacción en el bus sin esperar a que termine
+ *
+ * La transacción se ejecuta por DMA a continuación de las que ya estaban en la cola,
+ * seleccionando al dispositivo durante toda la transferencia. La memoria de la transacción y de
+ * sus datos debe permanecer valida hasta que la misma termine.
+ *
+ * Una secuencia de transacciones con la bandera hold mantiene seleccionado al dispositivo entre
+ * una y otra, por lo que mientras dure no deben encolarse transacciones de otros dispositivos.
+ *
+ * @remark La transacción debe estar completamente inicializada, con SPI_TRANSFER o con un
+ * inicializador designado. Una bandera unselected o hold con basura de la pila deja al
+ * dispositivo sin seleccionar o seleccionado de más.
+ *
+ * @param   transfer    Puntero a la transacción
+ * @return  true        La transacción se encoló correctamente
+ * @return  false       La cola está llena o la longitud no es valida
+ */
+bool SpiSubmit(spi_transfer_t transfer);
+
+/**
+ * @brief Metodo para esperar que termine una transacción encolada
+ *
+ * La tarea que llama queda bloqueada, sin consumir tiempo de procesador, hasta que el DMA termina
+ * la transacción.
+ *
+ * @param   transfer    Puntero a la transacción
+ * @return  true        La transacción terminó correctamente
+ * @return  false       La transacción terminó con un error de bus
+ */
+bool SpiWait(spi_transfer_t transfer);
+
+/**
+ * @brief Metodo para realizar una transacción y esperar a que termine
+ *
+ * Se aplican las mismas condiciones que en SpiSubmit, la transacción debe estar completamente
+ * inicializada.
+ *
+ * @param   transfer    Puntero a la transacción
+ * @return  true        La transacción terminó correctamente
+ * @return  false       La transacción no se pudo encolar o terminó con un error
+ */
+bool SpiTransfer(spi_transfer_t transfer);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SPI_H */
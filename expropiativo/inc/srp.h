@@ -0,0 +1,174 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRP_H
+#define SRP_H
+
+/** \brief Stack Resource Policy jobs declarations
+ **
+ ** Modo de planificación con trabajos que se ejecutan hasta terminar, sin bloquearse nunca, en
+ ** una única pila compartida. Cada nivel de expropiación se asocia a una interrupción del NVIC y
+ ** los trabajos del mismo nivel se ejecutan uno detrás de otro, por lo que nunca se intercalan.
+ ** Los recursos compartidos usan el techo de prioridad inmediato: al tomarlos se enmascaran con
+ ** BASEPRI todos los niveles que pueden usarlos, de manera que no es posible un bloqueo mutuo.
+ **
+ ** \addtogroup kernel Kernel
+ ** \brief Núcleo de planificación expropiativo
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/** Cantidad de bytes de la pila compartida por todos los trabajos */
+#ifndef SRP_STACK_SIZE
+    #define SRP_STACK_SIZE 1024
+#endif
+
+/** Cantidad de niveles de expropiación, uno por cada interrupción de SRP_LEVEL_IRQS */
+#ifndef SRP_LEVELS
+    #define SRP_LEVELS 4
+#endif
+
+/** Interrupciones de periféricos sin usar que despachan cada nivel, de menor a mayor */
+#ifndef SRP_LEVEL_IRQS
+    #define SRP_LEVEL_IRQS {I2S0_IRQn, I2S1_IRQn, C_CAN0_IRQn, C_CAN1_IRQn}
+#endif
+
+/** Cantidad de trabajos disponibles en el sistema */
+#ifndef SRP_JOB_INSTANCES
+    #define SRP_JOB_INSTANCES 16
+#endif
+
+/** Cantidad de recursos disponibles en el sistema */
+#ifndef SRP_RESOURCE_INSTANCES
+    #define SRP_RESOURCE_INSTANCES 8
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Función que implementa un trabajo, se ejecuta hasta terminar y no puede bloquearse
+typedef void (*trabajo_funcion_t)(void * argumento);
+
+//! Referencia a un descriptor para gestionar un trabajo
+typedef struct trabajo_s * trabajo_t;
+
+//! Referencia a un descriptor para gestionar un recurso compartido
+typedef struct recurso_s * recurso_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para iniciar el modo de trabajos con pila compartida
+ *
+ * Instala el despachador de cada nivel en la tabla de vectores en RAM, con una prioridad en el
+ * NVIC mayor que la del cambio de contexto de las tareas y creciente con el nivel.
+ */
+void TrabajosIniciar(void);
+
+/**
+ * @brief Metodo para crear un trabajo
+ *
+ * @param   funcion     Función que implementa el trabajo
+ * @param   argumento   Valor que recibe la función en cada ejecución
+ * @param   nivel       Nivel de expropiación, entre 0 y SRP_LEVELS - 1, mayor valor expropia
+ * @return  trabajo_t   Puntero al descriptor del trabajo, o NULL si no hay descriptores
+ */
+trabajo_t TrabajoCrear(trabajo_funcion_t funcion, void * argumento, uint8_t nivel);
+
+/**
+ * @brief Metodo para solicitar una ejecución de un trabajo
+ *
+ * El trabajo se ejecuta en cuanto su nivel sea el más alto pendiente, una vez por cada
+ * activación. Puede llamarse desde una tarea, desde otro trabajo o desde una rutina de servicio
+ * de interrupción.
+ *
+ * @param   trabajo     Puntero al descriptor del trabajo
+ */
+void TrabajoActivar(trabajo_t trabajo);
+
+/**
+ * @brief Metodo para crear un recurso compartido
+ *
+ * @param   techo       Nivel más alto de los trabajos que usan el recurso
+ * @return  recurso_t   Puntero al descriptor del recurso, o NULL si no hay descriptores
+ */
+recurso_t RecursoCrear(uint8_t techo);
+
+/**
+ * @brief Metodo para tomar un recurso compartido
+ *
+ * Eleva la prioridad hasta el techo del recurso, por lo que nunca bloquea. Los recursos se deben
+ * liberar en el orden inverso al que se tomaron.
+ *
+ * @param   recurso     Puntero al descriptor del recurso
+ */
+void RecursoTomar(recurso_t recurso);
+
+/**
+ * @brief Metodo para liberar un recurso compartido
+ *
+ * @param   recurso     Puntero al descriptor del recurso
+ */
+void RecursoLiberar(recurso_t recurso);
+
+/**
+ * @brief Metodo para medir el uso de la pila compartida por los trabajos
+ *
+ * Permite ajustar SRP_STACK_SIZE a la cadena de expropiación más profunda observada.
+ *
+ * @return  uint16_t    Máxima cantidad de bytes usados de la pila compartida
+ */
+uint16_t TrabajosUsoPila(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SRP_H */
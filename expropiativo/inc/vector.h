@@ -0,0 +1,113 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef VECTOR_H
+#define VECTOR_H
+
+/** \brief RAM vector table declarations
+ **
+ ** Copia la tabla de vectores de interrupción a la memoria RAM para que las rutinas de servicio
+ ** se puedan instalar en tiempo de ejecución, junto con su prioridad en el NVIC, en lugar de
+ ** quedar fijadas por nombre en el código de arranque. Opcionalmente una rutina se instala a
+ ** través de un envoltorio que informa al núcleo la entrada y la salida de la interrupción.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "chip.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad de interrupciones de periféricos del núcleo Cortex-M4 del LPC4337
+#ifndef VECTOR_IRQ_COUNT
+    #define VECTOR_IRQ_COUNT 53
+#endif
+
+//! Cantidad total de entradas de la tabla, incluyendo el puntero de pila y las excepciones
+#define VECTOR_COUNT (16 + VECTOR_IRQ_COUNT)
+
+/* === Public data type declarations =========================================================== */
+
+//! Rutina de servicio de una interrupción
+typedef void (*vector_handler_t)(void);
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para trasladar la tabla de vectores a la memoria RAM
+ *
+ * Copia la tabla vigente, normalmente la del código de arranque en la flash, y la activa con el
+ * registro VTOR. Las rutinas enlazadas por nombre siguen funcionando hasta que se reemplazan.
+ * Llamadas posteriores no tienen efecto.
+ */
+void VectorTableRelocate(void);
+
+/**
+ * @brief Metodo para instalar la rutina de servicio de una interrupción
+ *
+ * Asigna la prioridad en el NVIC y, para las interrupciones de periféricos, la habilita. Si la
+ * tabla todavía no está en RAM se traslada primero.
+ *
+ * @param   irq         Número de la interrupción, negativo para las excepciones del procesador
+ * @param   handler     Rutina de servicio de la interrupción
+ * @param   priority    Prioridad en el NVIC, menor valor indica mayor prioridad
+ * @param   wrapped     La rutina se llama entre InterrupcionEntrar e InterrupcionSalir, de manera
+ *                      que los cambios de contexto se posterguen hasta la salida más externa
+ * @return  true        La rutina se instaló
+ * @return  false       El número de interrupción no es válido
+ */
+bool VectorInstall(IRQn_Type irq, vector_handler_t handler, uint8_t priority, bool wrapped);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* VECTOR_H */
@@ -0,0 +1,153 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WORKER_H
+#define WORKER_H
+
+/** \brief Worker task pool declarations
+ **
+ ** Un conjunto fijo de tareas de trabajo comparte una cola de trabajos independientes. Cualquier
+ ** tarea puede encolar un trabajo y seguir, o encolarlo y esperar a que termine, sin necesidad de
+ ** una tarea con su propia pila para cada tipo de trabajo. Las ráfagas de trabajos se reparten
+ ** entre todas las tareas de trabajo disponibles.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+//! Cantidad máxima de trabajos pendientes en la cola, hasta QUEUE_LENGTH
+#ifndef WORKER_QUEUE_LENGTH
+    #define WORKER_QUEUE_LENGTH 8
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+//! Función que ejecuta un trabajo, recibe los datos definidos en el trabajo
+typedef void (*worker_function_t)(void * data);
+
+//! Trabajo para las tareas de trabajo, la memoria es provista por la tarea que lo solicita
+typedef struct worker_job_s {
+    worker_function_t function; //!< Función que ejecuta el trabajo
+    void * data;                //!< Datos que se entregan a la función
+    volatile bool done;         //!< Indica que el trabajo terminó, asignado por la tarea de trabajo
+    int task;                   //!< Tarea que se notifica al terminar, asignada al encolar
+} * worker_job_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para crear la cola de trabajos
+ *
+ * Las tareas de trabajo deben crearse aparte, con WorkerTask como función de entrada, antes de
+ * arrancar el sistema. La cantidad de tareas define cuantos trabajos se ejecutan a la vez.
+ *
+ * @return  true        La cola de trabajos se creó
+ * @return  false       No hay colas disponibles en el kernel
+ */
+bool WorkerPoolCreate(void);
+
+/**
+ * @brief Metodo para encolar un trabajo sin esperar a que termine
+ *
+ * Si la cola está llena la tarea queda bloqueada hasta que una tarea de trabajo retire uno. La
+ * memoria del trabajo debe seguir siendo válida hasta que done sea verdadero.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   job         Puntero al trabajo
+ */
+void WorkerSubmit(worker_job_t job);
+
+/**
+ * @brief Metodo para encolar un trabajo sin bloquear
+ *
+ * Puede llamarse tanto desde una tarea como desde una rutina de servicio de interrupción.
+ *
+ * @param   job         Puntero al trabajo
+ * @return  true        El trabajo se encoló
+ * @return  false       La cola de trabajos estaba llena
+ */
+bool WorkerTrySubmit(worker_job_t job);
+
+/**
+ * @brief Metodo para encolar un trabajo y esperar a que termine
+ *
+ * La tarea queda bloqueada, sin consumir tiempo de procesador, hasta que una tarea de trabajo
+ * termina de ejecutar el trabajo.
+ *
+ * @remark Solo puede llamarse desde una tarea, nunca desde una interrupción
+ *
+ * @param   job         Puntero al trabajo
+ */
+void WorkerRun(worker_job_t job);
+
+/**
+ * @brief Metodo para consultar la cantidad de trabajos que esperan una tarea de trabajo
+ *
+ * @return  uint8_t     Cantidad de trabajos en la cola
+ */
+uint8_t WorkerPending(void);
+
+/**
+ * @brief Función de entrada común a todas las tareas de trabajo
+ *
+ * Retira trabajos de la cola y los ejecuta indefinidamente, notificando a la tarea que espera
+ * cada uno al terminar.
+ */
+void WorkerTask(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* WORKER_H */
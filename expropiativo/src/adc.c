@@ -0,0 +1,188 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Analog input streaming definitions
+ **
+ ** Las conversiones del ADC0 se disparan con la salida de coincidencia MAT0 del temporizador 2,
+ ** que llega a la entrada de arranque CTOUT_8 del conversor. Cada resultado genera un pedido al
+ ** controlador GPDMA, que recorre una lista circular de dos descriptores, uno por cada mitad del
+ ** buffer, y solo interrumpe al procesador al completar cada mitad.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "adc.h"
+#include "chip.h"
+#include "dma.h"
+#include "kernel.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Temporizador que dispara las conversiones del ADC
+#define ADC_TRIGGER_TIMER LPC_TIMER2
+
+//! Reloj del temporizador que dispara las conversiones del ADC
+#define ADC_TRIGGER_CLOCK CLK_MX_TIMER2
+
+//! Valor central de la escala del conversor de 10 bits
+#define ADC_MIDSCALE 512
+
+/* === Private data type declarations ========================================================== */
+
+//! Bloque del buffer de adquisición, con los resultados crudos o ya convertidos a Q15
+typedef union adc_block_u {
+    uint32_t raw[ADC_BLOCK_SIZE];     //!< Registros de resultado copiados por el DMA
+    int16_t samples[ADC_BLOCK_SIZE];  //!< Muestras convertidas entregadas a la aplicación
+} adc_block_t;
+
+//! Estructura para almacenar el descriptor de una adquisición continua
+struct adc_stream_s {
+    adc_block_t block[2];                     //!< Bloques del buffer ping-pong
+    DMA_TransferDescriptor_t descriptor[2];   //!< Lista circular de descriptores del DMA
+    semaforo_t ready;                         //!< Semaforo liberado con cada bloque completado
+    volatile uint32_t produced;               //!< Cantidad de bloques completados por el DMA
+    uint32_t consumed;                        //!< Cantidad de bloques entregados a la aplicación
+    uint32_t overruns;                        //!< Cantidad de bloques descartados
+    bool allocated;                           //!< Bandera para indicar que el descriptor esta en uso
+};
+
+/* === Private variable declarations =========================================================== */
+
+static struct adc_stream_s instance = {0};
+
+/* === Private function declarations =========================================================== */
+
+// Función que atiende la interrupción del DMA al completar cada bloque
+static void AdcStreamHandler(void * data, bool error);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void AdcStreamHandler(void * data, bool error) {
+    adc_stream_t stream = data;
+
+    if (!error) {
+        stream->produced++;
+        SemaforoLiberar(stream->ready);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+adc_stream_t AdcStreamCreate(uint8_t channel, uint32_t sample_rate) {
+    ADC_CLOCK_SETUP_T setup;
+    uint32_t period;
+    int dma;
+
+    /* La salida del temporizador conmuta en cada coincidencia, con un periodo mínimo de uno */
+    if (instance.allocated || (sample_rate == 0) ||
+        (sample_rate > Chip_Clock_GetRate(ADC_TRIGGER_CLOCK) / 2)) {
+        return NULL;
+    }
+
+    dma = DmaChannelAllocate(AdcStreamHandler, &instance);
+    if (dma < 0) {
+        return NULL;
+    }
+    instance.ready = SemaforoCrear(0);
+    if (!instance.ready) {
+        DmaChannelRelease(dma);
+        return NULL;
+    }
+    instance.allocated = true;
+
+    Chip_SCU_ADC_Channel_Config(0, channel);
+    Chip_ADC_Init(LPC_ADC0, &setup);
+    Chip_ADC_EnableChannel(LPC_ADC0, channel, ENABLE);
+    Chip_ADC_Int_SetChannelCmd(LPC_ADC0, channel, ENABLE);
+    NVIC_DisableIRQ(ADC0_IRQn);
+
+    for (int index = 0; index < 2; index++) {
+        Chip_GPDMA_InitDescriptor(LPC_GPDMA, &instance.descriptor[index], GPDMA_CONN_ADC_0,
+                                  (uint32_t)instance.block[index].raw, ADC_BLOCK_SIZE,
+                                  GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA,
+                                  &instance.descriptor[1 - index]);
+        instance.descriptor[index].ctrl |= GPDMA_DMACCxControl_I;
+    }
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, dma, &instance.descriptor[0],
+                          GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+
+    /* El ADC arranca en el flanco ascendente y la salida conmuta en cada coincidencia */
+    Chip_ADC_SetStartMode(LPC_ADC0, ADC_START_ON_CTOUT8, ADC_TRIGGERMODE_RISING);
+    period = Chip_Clock_GetRate(ADC_TRIGGER_CLOCK) / (2 * sample_rate);
+
+    Chip_TIMER_Init(ADC_TRIGGER_TIMER);
+    Chip_TIMER_Reset(ADC_TRIGGER_TIMER);
+    Chip_TIMER_SetMatch(ADC_TRIGGER_TIMER, 0, period - 1);
+    Chip_TIMER_ResetOnMatchEnable(ADC_TRIGGER_TIMER, 0);
+    Chip_TIMER_ExtMatchControlSet(ADC_TRIGGER_TIMER, 0, TIMER_EXTMATCH_TOGGLE, 0);
+    Chip_TIMER_Enable(ADC_TRIGGER_TIMER);
+
+    return &instance;
+}
+
+int16_t * AdcStreamRead(adc_stream_t stream) {
+    adc_block_t * block;
+    uint32_t produced;
+
+    do {
+        SemaforoTomar(stream->ready);
+        produced = stream->produced;
+    } while (produced == stream->consumed);
+
+    stream->overruns += produced - stream->consumed - 1;
+    stream->consumed = produced;
+
+    /* Cada muestra de 16 bits se escribe por delante del registro de 32 bits que la origina */
+    block = &stream->block[(produced - 1) & 1];
+    for (int index = 0; index < ADC_BLOCK_SIZE; index++) {
+        int32_t result = ADC_DR_RESULT(block->raw[index]);
+        block->samples[index] = (int16_t)((result - ADC_MIDSCALE) * 64);
+    }
+    return block->samples;
+}
+
+uint32_t AdcStreamOverruns(adc_stream_t stream) {
+    return stream->overruns;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -51,6 +51,9 @@
 
 static struct board_s board = {0};
 
+//! Cantidad de interrupciones por segundo del temporizador del sistema, cero si no se configuró
+static uint16_t tick_rate = 0;
+
 /* === Private function declarations =========================================================== */
 
 /* === Public variable definitions ============================================================= */
@@ -103,15 +106,27 @@ void SisTick_Init(uint16_t ticks) {
     __asm volatile("cpsid i");
 
     /* Activate SysTick */
+    tick_rate = ticks;
     SystemCoreClockUpdate();
     SysTick_Config(SystemCoreClock / ticks);
 
     /* Update priority set by SysTick_Config */
     NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
 
+    /* The context switch runs in PendSV, after any other pending interrupt */
+    NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+
     __asm volatile("cpsie i");
 }
 
+void SisTick_Update(void) {
+    if (tick_rate) {
+        /* Keep the tick rate after a core clock change, restarting the current period */
+        SysTick->LOAD = SystemCoreClock / tick_rate - 1;
+        SysTick->VAL = 0;
+    }
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
@@ -0,0 +1,112 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Core clock configuration definitions
+ **
+ ** El cambio de frecuencia se realiza con las interrupciones deshabilitadas, ya que mientras el
+ ** PLL se reprograma el procesador funciona directamente con el cristal.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "clock.h"
+#include "bsp.h"
+#include "chip.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! Frecuencia del procesador en cada perfil de funcionamiento
+static const uint32_t frequencies[] = {
+    [CLOCK_PROFILE_PERFORMANCE] = CLOCK_PERFORMANCE_FREQUENCY,
+    [CLOCK_PROFILE_LOW_POWER] = CLOCK_LOW_POWER_FREQUENCY,
+};
+
+//! Perfil de funcionamiento actual
+static clock_profile_t current = CLOCK_PROFILE_PERFORMANCE;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+uint32_t ClockSetProfile(clock_profile_t profile) {
+    uint32_t frequency;
+    uint32_t estado;
+
+    if (profile > CLOCK_PROFILE_LOW_POWER) {
+        return SystemCoreClock;
+    }
+    frequency = frequencies[profile];
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+
+    SystemCoreClockUpdate();
+    if (frequency > SystemCoreClock) {
+        Chip_CREG_SetFlashAcceleration(frequency);
+    }
+    Chip_SetupCoreClock(CLKIN_CRYSTAL, frequency, false);
+    SystemCoreClockUpdate();
+    Chip_CREG_SetFlashAcceleration(SystemCoreClock);
+    current = profile;
+
+    SisTick_Update();
+    __set_PRIMASK(estado);
+
+    return SystemCoreClock;
+}
+
+clock_profile_t ClockGetProfile(void) {
+    return current;
+}
+
+uint32_t ClockGetFrequency(void) {
+    return SystemCoreClock;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
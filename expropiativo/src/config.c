@@ -0,0 +1,316 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Persistent configuration parameters definitions
+ **
+ ** Cada página del registro tiene un numero de secuencia, con su complemento para detectar una
+ ** programación interrumpida, y hasta quince registros de un parámetro con su valor. Los cambios
+ ** se escriben siempre en la página que sigue a la más reciente, por lo que el desgaste se
+ ** reparte en forma pareja entre todas las páginas. Antes de escribir una página se copian en ella
+ ** los parámetros cuyo último valor está en la página siguiente, de manera que la próxima página
+ ** a escribir nunca tiene el único valor guardado de un parámetro.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "config.h"
+#include "chip.h"
+#include "kernel.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Cantidad de registros de parámetros de cada página
+#define CONFIG_RECORDS_PER_PAGE ((EEPROM_PAGE_SIZE - 8) / 8)
+
+//! Numero de parámetro de un registro vacío
+#define CONFIG_EMPTY 0xFFFF
+
+#if CONFIG_PAGES * CONFIG_RECORDS_PER_PAGE < 3 * CONFIG_MAX_PARAMETERS
+    #error "El registro de parámetros necesita más páginas"
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+//! Registro con el valor de un parámetro
+typedef struct config_record_s {
+    uint16_t id;      //!< Numero del parámetro, o CONFIG_EMPTY si el registro está vacío
+    uint16_t check;   //!< Verificación del numero y el valor del parámetro
+    uint32_t value;   //!< Valor del parámetro
+} config_record_t;
+
+//! Contenido de una página del registro de parámetros
+typedef struct config_page_s {
+    uint32_t sequence;                                  //!< Numero de secuencia de la página
+    uint32_t inverted;                                  //!< Complemento del numero de secuencia
+    config_record_t records[CONFIG_RECORDS_PER_PAGE];   //!< Registros de la página
+} config_page_t;
+
+//! Estructura para almacenar el estado de los parámetros
+struct config_s {
+    uint32_t values[CONFIG_MAX_PARAMETERS];      //!< Valores actuales de los parámetros
+    uint8_t locations[CONFIG_MAX_PARAMETERS];    //!< Página con el último valor guardado
+    uint32_t stored;                             //!< Parámetros con algún valor guardado
+    volatile uint32_t dirty;                     //!< Parámetros modificados sin guardar
+    uint8_t count;                               //!< Cantidad de parámetros
+    uint8_t head;                                //!< Página escrita más recientemente
+    uint32_t sequence;                           //!< Numero de secuencia de la página más reciente
+    semaforo_t lock;                             //!< Acceso exclusivo a la EEPROM
+    semaforo_t programmed;                       //!< Fin de la programación de una página
+    semaforo_t pending;                          //!< Cambios listos para guardar
+    temporizador_t timer;                        //!< Demora para agrupar los cambios
+    config_page_t image;                         //!< Contenido de la página a programar
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Estado de los parámetros del sistema
+static struct config_s config = {0};
+
+/* === Private function declarations =========================================================== */
+
+// Función que calcula la verificación de un registro
+static uint16_t ConfigCheck(uint16_t id, uint32_t value);
+
+// Función que devuelve un puntero de lectura a una página del registro
+static const config_page_t * ConfigPage(uint8_t page);
+
+// Función que programa la imagen de una página y espera que termine
+static void ConfigProgram(uint8_t page);
+
+// Función que se ejecuta al cumplirse la demora desde el último cambio
+static void ConfigTimeout(void * data);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint16_t ConfigCheck(uint16_t id, uint32_t value) {
+    return 0xA55A ^ id ^ (value & 0xFFFF) ^ (value >> 16);
+}
+
+static const config_page_t * ConfigPage(uint8_t page) {
+    return (const config_page_t *)EEPROM_ADDRESS(CONFIG_FIRST_PAGE + page, 0);
+}
+
+static void ConfigProgram(uint8_t page) {
+    volatile uint32_t * latch = (volatile uint32_t *)EEPROM_ADDRESS(CONFIG_FIRST_PAGE + page, 0);
+    const uint32_t * words = (const uint32_t *)&config.image;
+
+    /* La página a programar queda determinada por la última escritura en el buffer de página */
+    for (unsigned int index = 0; index < sizeof(config_page_t) / sizeof(uint32_t); index++) {
+        latch[index] = words[index];
+    }
+    Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    Chip_EEPROM_SetCmd(LPC_EEPROM, EEPROM_CMD_ERASE_PRG_PAGE);
+    SemaforoTomar(config.programmed);
+}
+
+static void ConfigTimeout(void * data) {
+    SemaforoLiberar(config.pending);
+}
+
+/* === Public function implementation ========================================================= */
+
+void EEPROM_IRQHandler(void) {
+    Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    SemaforoLiberar(config.programmed);
+}
+
+bool ConfigLoad(const uint32_t * defaults, uint8_t count) {
+    uint32_t sequences[CONFIG_MAX_PARAMETERS] = {0};
+    const config_page_t * page;
+    const config_record_t * record;
+
+    if ((count == 0) || (count > CONFIG_MAX_PARAMETERS) || config.count) {
+        return false;
+    }
+
+    config.lock = SemaforoCrear(1);
+    config.programmed = SemaforoCrear(0);
+    config.pending = SemaforoCrear(0);
+    config.timer = TemporizadorCrear(ConfigTimeout, NULL);
+    if (!config.lock || !config.programmed || !config.pending || !config.timer) {
+        SemaforoDestruir(config.lock);
+        SemaforoDestruir(config.programmed);
+        SemaforoDestruir(config.pending);
+        TemporizadorDestruir(config.timer);
+        config.lock = NULL;
+        config.programmed = NULL;
+        config.pending = NULL;
+        config.timer = NULL;
+        return false;
+    }
+
+    config.count = count;
+    for (int id = 0; id < count; id++) {
+        config.values[id] = defaults[id];
+    }
+
+    Chip_EEPROM_Init(LPC_EEPROM);
+    for (int index = 0; index < CONFIG_PAGES; index++) {
+        page = ConfigPage(index);
+        if ((page->sequence == 0) || ((page->sequence ^ page->inverted) != 0xFFFFFFFF)) {
+            continue;
+        }
+        if (page->sequence > config.sequence) {
+            config.sequence = page->sequence;
+            config.head = index;
+        }
+        for (int slot = 0; slot < CONFIG_RECORDS_PER_PAGE; slot++) {
+            record = &page->records[slot];
+            if ((record->id < count) && (record->check == ConfigCheck(record->id, record->value)) &&
+                (page->sequence > sequences[record->id])) {
+                sequences[record->id] = page->sequence;
+                config.values[record->id] = record->value;
+                config.locations[record->id] = index;
+                config.stored |= 1UL << record->id;
+            }
+        }
+    }
+
+    Chip_EEPROM_EnableInt(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    NVIC_ClearPendingIRQ(EEPROM_IRQn);
+    NVIC_EnableIRQ(EEPROM_IRQn);
+    return true;
+}
+
+uint32_t ConfigGet(uint8_t id) {
+    return (id < config.count) ? config.values[id] : 0;
+}
+
+void ConfigSet(uint8_t id, uint32_t value) {
+    uint32_t estado;
+
+    if ((id >= config.count) || (config.values[id] == value)) {
+        return;
+    }
+    estado = __get_PRIMASK();
+    __disable_irq();
+    config.values[id] = value;
+    config.dirty |= 1UL << id;
+    __set_PRIMASK(estado);
+
+    if (config.timer) {
+        TemporizadorIniciar(config.timer, MS_TO_TICKS(CONFIG_COMMIT_DELAY));
+    }
+}
+
+bool ConfigCommit(void) {
+    uint8_t page;
+    uint8_t following;
+    uint32_t pending;
+    uint32_t written;
+    uint32_t estado;
+    int slot;
+
+    if (!config.count) {
+        return false;
+    }
+    SemaforoTomar(config.lock);
+
+    while (config.dirty) {
+        page = (config.head + 1) % CONFIG_PAGES;
+        following = (page + 1) % CONFIG_PAGES;
+        written = 0;
+        slot = 0;
+
+        config.image.sequence = config.sequence + 1;
+        config.image.inverted = ~config.image.sequence;
+
+        /* Primero se rescatan todos los parámetros cuyo último valor está en la página siguiente,
+         * estén pendientes o no, porque el segundo paso puede quedarse sin registros */
+        for (int pass = 0; pass < 2; pass++) {
+            estado = __get_PRIMASK();
+            __disable_irq();
+            pending = config.dirty;
+            __set_PRIMASK(estado);
+
+            for (int id = 0; (id < config.count) && (slot < CONFIG_RECORDS_PER_PAGE); id++) {
+                bool rescue = (config.stored & (1UL << id)) && (config.locations[id] == following);
+                bool include = (pass == 0) ? rescue : (pending & (1UL << id)) != 0;
+                if (include && !(written & (1UL << id))) {
+                    uint32_t value = config.values[id];
+                    config.image.records[slot].id = id;
+                    config.image.records[slot].value = value;
+                    config.image.records[slot].check = ConfigCheck(id, value);
+                    written |= 1UL << id;
+                    slot++;
+                }
+            }
+        }
+        for (; slot < CONFIG_RECORDS_PER_PAGE; slot++) {
+            config.image.records[slot] = (config_record_t){.id = CONFIG_EMPTY, .check = 0};
+        }
+
+        ConfigProgram(page);
+
+        config.head = page;
+        config.sequence = config.image.sequence;
+        for (int id = 0; id < config.count; id++) {
+            if (written & (1UL << id)) {
+                config.locations[id] = page;
+            }
+        }
+        estado = __get_PRIMASK();
+        __disable_irq();
+        config.stored |= written;
+        /* Un parámetro que cambió durante la programación sigue pendiente */
+        for (int index = 0; index < CONFIG_RECORDS_PER_PAGE; index++) {
+            config_record_t * record = &config.image.records[index];
+            if ((record->id < config.count) && (config.values[record->id] == record->value)) {
+                config.dirty &= ~(1UL << record->id);
+            }
+        }
+        __set_PRIMASK(estado);
+    }
+
+    SemaforoLiberar(config.lock);
+    return true;
+}
+
+void ConfigTask(void) {
+    while (1) {
+        SemaforoTomar(config.pending);
+        ConfigCommit();
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
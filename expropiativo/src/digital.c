@@ -45,13 +45,14 @@
 
 /* === Macros definitions ====================================================================== */
 
+//! Cantidad de entradas, las cuatro teclas de la placa y las filas de un teclado matricial
 #ifndef INPUT_INSTANCES
-    #define INPUT_INSTANCES        4
+    #define INPUT_INSTANCES        8
 #endif
 
-
+//! Cantidad de salidas, los cuatro leds de la placa y las columnas de un teclado matricial
 #ifndef OUTPUT_INSTANCES
-    #define OUTPUT_INSTANCES       4
+    #define OUTPUT_INSTANCES       8
 #endif
 
 /* === Private data type declarations ========================================================== */
@@ -133,6 +134,12 @@ digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted) {
     return input;
 }
 
+void DigitalInputDestroy(digital_input_t input) {
+    if (input) {
+        input->allocated = false;
+    }
+}
+
 bool DigitalInputGetState(digital_input_t input) {
     return input->inverted ^ Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->port, input->pin);
 }
@@ -171,6 +178,13 @@ digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin) {
     return output;
 }
 
+void DigitalOutputDestroy(digital_output_t output) {
+    if (output) {
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, output->port, output->pin, false);
+        output->allocated = false;
+    }
+}
+
 void DigitalOutputActivate(digital_output_t output) {
     Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->port, output->pin, true);
 }
@@ -0,0 +1,295 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Multiplexed seven segments display definitions
+ **
+ ** La memoria de la pantalla guarda, para cada digito, el valor del puerto de segmentos ya
+ ** calculado al escribir, incluyendo el punto y la habilitación del digito cuando comparten ese
+ ** puerto. La interrupción del temporizador hace una sola escritura enmascarada por cada puerto
+ ** involucrado, sin ninguna traducción ni recorrido de tablas: si todos los terminales están en el
+ ** mismo puerto los segmentos y el digito cambian con una única escritura. En el poncho de la
+ ** placa los segmentos, el punto y los digitos están en tres puertos distintos, por lo que se
+ ** necesitan tres escrituras, y la de los digitos apaga el anterior y enciende el nuevo a la vez.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "display.h"
+#include "chip.h"
+#include "poncho.h"
+
+/* === Macros definitions ====================================================================== */
+
+#if (SEGMENT_A_GPIO != SEGMENT_G_GPIO) || (SEGMENT_B_GPIO != SEGMENT_G_GPIO) ||                   \
+    (SEGMENT_C_GPIO != SEGMENT_G_GPIO) || (SEGMENT_D_GPIO != SEGMENT_G_GPIO) ||                   \
+    (SEGMENT_E_GPIO != SEGMENT_G_GPIO) || (SEGMENT_F_GPIO != SEGMENT_G_GPIO)
+    #error "Los segmentos deben estar en el mismo puerto GPIO"
+#endif
+
+#if (DIGIT_1_GPIO != DIGIT_4_GPIO) || (DIGIT_2_GPIO != DIGIT_4_GPIO) ||                           \
+    (DIGIT_3_GPIO != DIGIT_4_GPIO)
+    #error "Los digitos deben estar en el mismo puerto GPIO"
+#endif
+
+//! Puerto GPIO de los segmentos
+#define SEGMENTS_GPIO SEGMENT_G_GPIO
+
+//! Puerto GPIO de los digitos
+#define DIGITS_GPIO DIGIT_4_GPIO
+
+//! Bits del puerto GPIO de los segmentos, sin el punto
+#define SEGMENTS_MASK                                                                              \
+    ((1 << SEGMENT_A_BIT) | (1 << SEGMENT_B_BIT) | (1 << SEGMENT_C_BIT) | (1 << SEGMENT_D_BIT) |  \
+     (1 << SEGMENT_E_BIT) | (1 << SEGMENT_F_BIT) | (1 << SEGMENT_G_BIT))
+
+//! Bits del puerto GPIO de los digitos
+#define DIGITS_MASK                                                                                \
+    ((1 << DIGIT_1_BIT) | (1 << DIGIT_2_BIT) | (1 << DIGIT_3_BIT) | (1 << DIGIT_4_BIT))
+
+//! El punto está en el puerto de los segmentos y se escribe junto con ellos
+#define POINT_SHARED (SEGMENT_P_GPIO == SEGMENTS_GPIO)
+
+//! Los digitos están en el puerto de los segmentos y se habilitan con la misma escritura
+#define DIGITS_SHARED (DIGITS_GPIO == SEGMENTS_GPIO)
+
+//! Bits que modifica la escritura enmascarada del puerto de los segmentos
+#define FRAME_MASK                                                                                 \
+    (SEGMENTS_MASK | (POINT_SHARED ? (1 << SEGMENT_P_BIT) : 0) | (DIGITS_SHARED ? DIGITS_MASK : 0))
+
+//! Temporizador que refresca la pantalla
+#define DISPLAY_TIMER LPC_TIMER1
+
+//! Reloj del temporizador que refresca la pantalla
+#define DISPLAY_CLOCK CLK_MX_TIMER1
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de la pantalla
+struct display_s {
+    volatile uint32_t frames[DISPLAY_DIGITS];   //!< Valor del puerto de segmentos de cada digito
+    volatile uint8_t points;                    //!< Puntos encendidos, un bit por digito
+    uint8_t active;                             //!< Digito encendido actualmente
+    bool allocated;                             //!< Bandera para indicar que ya fue creada
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Descriptor de la única pantalla de la placa
+static struct display_s instance = {0};
+
+//! Bits del puerto GPIO de cada digito, de izquierda a derecha
+static const uint32_t digit_masks[DISPLAY_DIGITS] = {
+    1 << DIGIT_1_BIT,
+    1 << DIGIT_2_BIT,
+    1 << DIGIT_3_BIT,
+    1 << DIGIT_4_BIT,
+};
+
+//! Bits del puerto GPIO de cada segmento, en el orden de las constantes DISPLAY_SEGMENT_x
+static const uint8_t segment_bits[] = {
+    SEGMENT_A_BIT, SEGMENT_B_BIT, SEGMENT_C_BIT, SEGMENT_D_BIT,
+    SEGMENT_E_BIT, SEGMENT_F_BIT, SEGMENT_G_BIT,
+};
+
+//! Segmentos encendidos para cada digito decimal
+static const uint8_t bcd_segments[] = {
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_D |
+        DISPLAY_SEGMENT_E | DISPLAY_SEGMENT_F,
+    DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_D | DISPLAY_SEGMENT_E |
+        DISPLAY_SEGMENT_G,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_D |
+        DISPLAY_SEGMENT_G,
+    DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_F | DISPLAY_SEGMENT_G,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_D | DISPLAY_SEGMENT_F |
+        DISPLAY_SEGMENT_G,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_D | DISPLAY_SEGMENT_E |
+        DISPLAY_SEGMENT_F | DISPLAY_SEGMENT_G,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_D |
+        DISPLAY_SEGMENT_E | DISPLAY_SEGMENT_F | DISPLAY_SEGMENT_G,
+    DISPLAY_SEGMENT_A | DISPLAY_SEGMENT_B | DISPLAY_SEGMENT_C | DISPLAY_SEGMENT_D |
+        DISPLAY_SEGMENT_F | DISPLAY_SEGMENT_G,
+};
+
+/* === Private function declarations =========================================================== */
+
+// Función que traduce una combinación de segmentos al valor del puerto GPIO
+static uint32_t DisplayPortValue(uint8_t segments);
+
+// Función que arma el valor del puerto de segmentos de un digito con su punto y su habilitación
+static uint32_t DisplayFrame(display_t display, uint8_t digit, uint32_t segments);
+
+// Función que configura un terminal de la pantalla como salida apagada
+static void DisplayPinInit(uint8_t port, uint8_t pin, uint16_t func, uint8_t gpio, uint8_t bit);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint32_t DisplayPortValue(uint8_t segments) {
+    uint32_t value = 0;
+
+    for (unsigned int index = 0; index < sizeof(segment_bits); index++) {
+        if (segments & (1 << index)) {
+            value |= 1 << segment_bits[index];
+        }
+    }
+    return value;
+}
+
+static uint32_t DisplayFrame(display_t display, uint8_t digit, uint32_t segments) {
+    uint32_t frame = segments & SEGMENTS_MASK;
+
+    if (POINT_SHARED && (display->points & (1 << digit))) {
+        frame |= 1 << SEGMENT_P_BIT;
+    }
+    if (DIGITS_SHARED) {
+        frame |= digit_masks[digit];
+    }
+    return frame;
+}
+
+static void DisplayPinInit(uint8_t port, uint8_t pin, uint16_t func, uint8_t gpio, uint8_t bit) {
+    Chip_SCU_PinMuxSet(port, pin, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | func);
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, gpio, bit, false);
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, gpio, bit, true);
+}
+
+/* === Public function implementation ========================================================= */
+
+void TIMER1_IRQHandler(void) {
+    struct display_s * display = &instance;
+    uint8_t digit = display->active;
+
+    Chip_TIMER_ClearMatch(DISPLAY_TIMER, 0);
+    digit = (digit + 1) % DISPLAY_DIGITS;
+    display->active = digit;
+
+    /* Una escritura enmascarada por puerto, las que no hacen falta las elimina el compilador */
+    LPC_GPIO_PORT->MPIN[SEGMENTS_GPIO] = display->frames[digit];
+    if (!POINT_SHARED) {
+        LPC_GPIO_PORT->B[SEGMENT_P_GPIO][SEGMENT_P_BIT] = (display->points >> digit) & 1;
+    }
+    if (!DIGITS_SHARED) {
+        /* Apaga el digito anterior y enciende el nuevo en la misma escritura */
+        LPC_GPIO_PORT->MPIN[DIGITS_GPIO] = digit_masks[digit];
+    }
+}
+
+display_t DisplayCreate(void) {
+    display_t display = &instance;
+
+    if (display->allocated) {
+        return NULL;
+    }
+    display->allocated = true;
+
+    DisplayPinInit(SEGMENT_A_PORT, SEGMENT_A_PIN, SEGMENT_A_FUNC, SEGMENT_A_GPIO, SEGMENT_A_BIT);
+    DisplayPinInit(SEGMENT_B_PORT, SEGMENT_B_PIN, SEGMENT_B_FUNC, SEGMENT_B_GPIO, SEGMENT_B_BIT);
+    DisplayPinInit(SEGMENT_C_PORT, SEGMENT_C_PIN, SEGMENT_C_FUNC, SEGMENT_C_GPIO, SEGMENT_C_BIT);
+    DisplayPinInit(SEGMENT_D_PORT, SEGMENT_D_PIN, SEGMENT_D_FUNC, SEGMENT_D_GPIO, SEGMENT_D_BIT);
+    DisplayPinInit(SEGMENT_E_PORT, SEGMENT_E_PIN, SEGMENT_E_FUNC, SEGMENT_E_GPIO, SEGMENT_E_BIT);
+    DisplayPinInit(SEGMENT_F_PORT, SEGMENT_F_PIN, SEGMENT_F_FUNC, SEGMENT_F_GPIO, SEGMENT_F_BIT);
+    DisplayPinInit(SEGMENT_G_PORT, SEGMENT_G_PIN, SEGMENT_G_FUNC, SEGMENT_G_GPIO, SEGMENT_G_BIT);
+    DisplayPinInit(SEGMENT_P_PORT, SEGMENT_P_PIN, SEGMENT_P_FUNC, SEGMENT_P_GPIO, SEGMENT_P_BIT);
+
+    DisplayPinInit(DIGIT_1_PORT, DIGIT_1_PIN, DIGIT_1_FUNC, DIGIT_1_GPIO, DIGIT_1_BIT);
+    DisplayPinInit(DIGIT_2_PORT, DIGIT_2_PIN, DIGIT_2_FUNC, DIGIT_2_GPIO, DIGIT_2_BIT);
+    DisplayPinInit(DIGIT_3_PORT, DIGIT_3_PIN, DIGIT_3_FUNC, DIGIT_3_GPIO, DIGIT_3_BIT);
+    DisplayPinInit(DIGIT_4_PORT, DIGIT_4_PIN, DIGIT_4_FUNC, DIGIT_4_GPIO, DIGIT_4_BIT);
+
+    /* Las escrituras enmascaradas solo modifican los bits de la pantalla en cada puerto */
+    LPC_GPIO_PORT->MASK[SEGMENTS_GPIO] = ~FRAME_MASK;
+    if (!DIGITS_SHARED) {
+        LPC_GPIO_PORT->MASK[DIGITS_GPIO] = ~DIGITS_MASK;
+    }
+
+    Chip_TIMER_Init(DISPLAY_TIMER);
+    Chip_TIMER_Reset(DISPLAY_TIMER);
+    Chip_TIMER_SetMatch(DISPLAY_TIMER, 0,
+                        Chip_Clock_GetRate(DISPLAY_CLOCK) / DISPLAY_REFRESH_RATE - 1);
+    Chip_TIMER_ResetOnMatchEnable(DISPLAY_TIMER, 0);
+    Chip_TIMER_MatchEnableInt(DISPLAY_TIMER, 0);
+    Chip_TIMER_Enable(DISPLAY_TIMER);
+
+    NVIC_ClearPendingIRQ(TIMER1_IRQn);
+    NVIC_EnableIRQ(TIMER1_IRQn);
+    return display;
+}
+
+void DisplayWriteBcd(display_t display, const uint8_t * number, uint8_t size) {
+    for (int digit = 0; digit < DISPLAY_DIGITS; digit++) {
+        if ((digit < size) && (number[digit] < sizeof(bcd_segments))) {
+            display->frames[digit] =
+                DisplayFrame(display, digit, DisplayPortValue(bcd_segments[number[digit]]));
+        } else {
+            display->frames[digit] = DisplayFrame(display, digit, 0);
+        }
+    }
+}
+
+void DisplayWriteSegments(display_t display, uint8_t digit, uint8_t segments) {
+    if (digit < DISPLAY_DIGITS) {
+        display->frames[digit] = DisplayFrame(display, digit, DisplayPortValue(segments));
+        DisplaySetPoint(display, digit, segments & DISPLAY_SEGMENT_P);
+    }
+}
+
+void DisplaySetPoint(display_t display, uint8_t digit, bool on) {
+    uint32_t estado;
+
+    if (digit < DISPLAY_DIGITS) {
+        estado = __get_PRIMASK();
+        __disable_irq();
+        if (on) {
+            display->points |= 1 << digit;
+        } else {
+            display->points &= ~(1 << digit);
+        }
+        if (POINT_SHARED) {
+            display->frames[digit] = DisplayFrame(display, digit, display->frames[digit]);
+        }
+        __set_PRIMASK(estado);
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,120 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief General purpose DMA channels definitions
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "dma.h"
+#include "chip.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de un canal de DMA
+struct dma_channel_s {
+    dma_handler_t handler; //!< Función que atiende las interrupciones del canal
+    void * data;           //!< Datos del controlador que reservó el canal
+};
+
+/* === Private variable declarations =========================================================== */
+
+static struct dma_channel_s channels[GPDMA_NUMBER_CHANNELS] = {0};
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================= */
+
+int DmaChannelAllocate(dma_handler_t handler, void * data) {
+    static bool initialized = false;
+    int result = -1;
+
+    if (!initialized) {
+        Chip_GPDMA_Init(LPC_GPDMA);
+        NVIC_EnableIRQ(DMA_IRQn);
+        initialized = true;
+    }
+
+    for (int index = 0; index < GPDMA_NUMBER_CHANNELS; index++) {
+        if (!channels[index].handler) {
+            channels[index].handler = handler;
+            channels[index].data = data;
+            result = index;
+            break;
+        }
+    }
+    return result;
+}
+
+void DmaChannelRelease(int channel) {
+    if ((channel >= 0) && (channel < GPDMA_NUMBER_CHANNELS)) {
+        LPC_GPDMA->CH[channel].CONFIG &= ~GPDMA_DMACCxConfig_E;
+        channels[channel].handler = NULL;
+        channels[channel].data = NULL;
+    }
+}
+
+void DMA_IRQHandler(void) {
+    uint32_t mask;
+    uint32_t errors;
+
+    /* El estado se lee canal por canal, porque una función puede detener otro canal y borrar su
+     * interrupción pendiente, que entonces ya no debe atenderse */
+    for (int index = 0; index < GPDMA_NUMBER_CHANNELS; index++) {
+        mask = 1 << index;
+        if (LPC_GPDMA->INTSTAT & mask) {
+            errors = LPC_GPDMA->INTERRSTAT & mask;
+            LPC_GPDMA->INTTCCLEAR = mask;
+            LPC_GPDMA->INTERRCLR = mask;
+            if (channels[index].handler) {
+                channels[index].handler(channels[index].data, errors);
+            }
+        }
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
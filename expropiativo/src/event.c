@@ -0,0 +1,127 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Publish/subscribe event bus definitions
+ **
+ ** Cada tarea tiene una palabra de banderas pendientes, un bit por tópico, que se modifica con las
+ ** interrupciones deshabilitadas. La publicación solo recorre la lista del tópico, por lo que su
+ ** duración está acotada por la cantidad de suscriptores definida al compilar.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "event.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! Banderas de los tópicos publicados y todavía no atendidos por cada tarea
+static volatile uint32_t pending[TASK_COUNT] = {0};
+
+//! Cantidad de mensajes descartados por colas llenas
+static volatile uint32_t overruns = 0;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+//! Tabla vacía que se usa cuando la aplicación no define sus propios tópicos
+__attribute__((weak)) const event_topic_t event_topics[EVENT_TOPICS] = {0};
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void EventPublish(uint8_t topic) {
+    const event_subscriber_t * subscriber;
+    uint32_t estado;
+
+    if (topic >= EVENT_TOPICS) {
+        return;
+    }
+
+    for (int index = 0; index < event_topics[topic].count; index++) {
+        subscriber = &event_topics[topic].subscribers[index];
+        if ((subscriber->task >= 0) && (subscriber->task < TASK_COUNT)) {
+            estado = __get_PRIMASK();
+            __disable_irq();
+            pending[subscriber->task] |= EVENT_MASK(topic);
+            __set_PRIMASK(estado);
+            TareaNotificar(subscriber->task);
+        }
+        if ((subscriber->queue != NULL) && (*subscriber->queue != NULL)) {
+            if (!ColaIntentarEnviar(*subscriber->queue, EVENT_MESSAGE(topic))) {
+                estado = __get_PRIMASK();
+                __disable_irq();
+                overruns++;
+                __set_PRIMASK(estado);
+            }
+        }
+    }
+}
+
+uint32_t EventWait(uint32_t topics) {
+    int tarea = TareaActual();
+    uint32_t result;
+
+    while (1) {
+        __disable_irq();
+        result = pending[tarea] & topics;
+        pending[tarea] &= ~result;
+        __enable_irq();
+
+        if (result) {
+            return result;
+        }
+        TareaEsperarNotificacion();
+    }
+}
+
+uint32_t EventOverruns(void) {
+    return overruns;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -56,48 +56,47 @@
 
 /* === Inclusiones de cabeceras ============================================ */
 
+#include "adc.h"
 #include "bsp.h"
+#include "clock.h"
+#include "config.h"
+#include "fft.h"
+#include "kernel.h"
+#include <stddef.h>
 #include <stdint.h>
-#include <string.h>
 
 /* === Definicion y Macros ================================================= */
 
-/** Cantidad de bytes para la pila de cada tarea */
-#define STACK_SIZE 256
+/** Valor por defecto de la cuenta para la función de espera */
+#define COUNT_DELAY 3000000
 
-/** Cantidad de tareas */
-#define TASK_COUNT 3
+/** Valor por defecto de la cantidad de ticks entre dos cambios del led de actividad */
+#define HEARTBEAT_TICKS 1000
 
-/** Valor de la cuenta para la función de espera */
-#define COUNT_DELAY 3000000
+/** Milisegundos entre dos lecturas de los botones */
+#define BUTTON_PERIOD 10
+
+/** Canal del ADC0 con el sensor de vibraciones */
+#define VIBRATION_CHANNEL 1
+
+/** Frecuencia de muestreo del sensor de vibraciones en Hz */
+#define VIBRATION_RATE 8000
 
 /* === Declaraciones de tipos de datos internos ============================ */
 
-typedef uint8_t stack_t[STACK_SIZE];
-
-typedef struct context_s {
-    struct {
-        uint32_t r4;
-        uint32_t r5;
-        uint32_t r6;
-        uint32_t r7;
-        uint32_t r8;
-        uint32_t r9;
-        uint32_t r10;
-        uint32_t r11;
-        uint32_t lr;
-    } aditional;
-    struct {
-        uint32_t r0;
-        uint32_t r1;
-        uint32_t r2;
-        uint32_t r3;
-        uint32_t ip;
-        uint32_t lr;
-        uint32_t pc;
-        uint32_t xPSR;
-    } interrupt;
-} * context_t;
+/** Parámetros del sistema que se pueden ajustar sin volver a compilar */
+typedef enum {
+    PARAMETRO_DEMORA = 0, /**< Valor de la cuenta para la función de espera */
+    PARAMETRO_LATIDO,     /**< Ticks entre dos cambios del led de actividad */
+    PARAMETROS_CANTIDAD,
+} parametro_t;
+
+/** Datos de cada una de las tareas que atienden un botón y un led */
+typedef struct boton_s {
+    digital_input_t entrada; /**< Botón que atiende la tarea */
+    digital_output_t salida; /**< Led que maneja la tarea */
+    bool seguir;             /**< El led sigue al botón o cambia con cada pulsación */
+} * boton_t;
 
 /* === Declaraciones de funciones internas ================================= */
 
@@ -115,48 +114,56 @@ void Delay(void);
  */
 void ConfigurarInterrupcion(void);
 
-/** @brief Funcion que implementa el cambio de contexto
+/** @brief Funcion que atiende la interrupción del temporizador del sistema
  **
- ** Cada vez que se llama a la función la misma almacena el contexto de la
- ** tarea que la llama, selecciona a la otra tarea como activa y recupera
- ** el contexto de la misma.
+ ** Cada vez que se llama a la función la misma informa al núcleo que
+ ** transcurrió un tick, el cual selecciona a la siguiente tarea lista
+ ** como activa y recupera el contexto de la misma.
  */
 void SysTick_Handler(void);
 
-/** @brief Funcion para configurar el contexto inicial de una tarea
+/** @brief Función que implementa las tareas que atienden un botón y un led
  **
- ** Esta función asigna la pila de una tarea y prepara el contexto
- ** inicial de la misma para que al atender una interrupción se pueda
- ** realizar el cambio de tareas cambiando el puntero de la pila
+ ** @param argumento Puntero a la estructura boton_s con los datos de la tarea
  */
-void CrearTarea(int id, void * entry_point);
+void TareaBoton(void * argumento);
+
+/** @brief Función que implementa la tarea de parpadeo del led amarillo */
+void TareaB(void);
 
-/** @brief Función que indica un error en el cambio de contexto
+/** @brief Función que implementa la tarea de análisis de vibraciones
  **
- ** @remark Esta funcion no debería ejecutarse nunca, solo se accede a la
- **         misma si las funciones que implementan las tareas terminan
+ ** Calcula la transformada de cada bloque de la adquisición y guarda la frecuencia de la
+ ** componente de mayor potencia. Se bloquea esperando cada bloque, por lo que solo consume el
+ ** tiempo de procesador de la transformada.
  */
-void Error(void);
+void TareaAnalisis(void);
 
-/** @brief Función que implementa la primera tarea del sistema */
-void TareaA(void);
+/* === Definiciones de variables internas ================================== */
 
-/** @brief Función que implementa la segunda tarea del sistema */
-void TareaB(void);
+/** Puntero para acceder a los recursos de la placa */
+board_t board;
 
-/** @brief Función que implementa la segunda tarea del sistema */
-void TareaC(void);
+/** Valores por defecto de los parámetros del sistema */
+static const uint32_t parametros[PARAMETROS_CANTIDAD] = {
+    [PARAMETRO_DEMORA] = COUNT_DELAY,
+    [PARAMETRO_LATIDO] = HEARTBEAT_TICKS,
+};
 
-/* === Definiciones de variables internas ================================== */
+/** Datos de las tareas que atienden un botón y un led, completados al crear la placa */
+static struct boton_s botones[2];
 
-/** Espacio para la pila de las tareas */
-static stack_t stack[TASK_COUNT];
+/** Adquisición continua del sensor de vibraciones */
+static adc_stream_t adquisicion;
 
-/** Punteros a contexto de cada tarea y del sistema operativo */
-static uint32_t context[TASK_COUNT + 1];
+/** Frecuencia en Hz de la componente de mayor potencia del último bloque analizado */
+volatile uint32_t vibracion;
 
-/** Puntero para acceder a los recursos de la placa */
-board_t board;
+/** Tareas del sistema, con su contexto inicial armado al compilar */
+TAREA_DECLARAR(0, TareaBoton, &botones[0]);
+TAREA_DECLARAR(1, TareaB, NULL);
+TAREA_DECLARAR(2, TareaBoton, &botones[1]);
+TAREA_DECLARAR(3, TareaAnalisis, NULL);
 
 /* === Definiciones de variables externas ================================== */
 
@@ -165,41 +172,21 @@ board_t board;
 void Delay(void) {
     uint32_t i;
 
-    for (i = COUNT_DELAY; i != 0; i--) {
+    for (i = ConfigGet(PARAMETRO_DEMORA); i != 0; i--) {
         __asm__("nop");
     }
 }
 
-__attribute__((naked(), optimize("O0"))) void SysTick_Handler(void) {
-    static int divisor = 0;
-    static int activa = TASK_COUNT;
-
-    __asm__("push {r4-r11, lr}");
-    __asm__("str r13, %0" : "=m"(context[activa]));
-    __asm__("ldr r13, %0" : : "m"(context[TASK_COUNT]));
+void SysTick_Handler(void) {
+    static uint32_t divisor = 0;
 
-    activa = (activa + 1) % TASK_COUNT;
-    divisor = (divisor + 1) % 1000;
-    if (divisor == 0)
+    divisor = divisor + 1;
+    if (divisor >= ConfigGet(PARAMETRO_LATIDO)) {
+        divisor = 0;
         DigitalOutputToggle(board->led_verde);
+    }
 
-    __asm__("str r13, %0" : "=m"(context[TASK_COUNT]));
-    __asm__("ldr r13, %0" : : "m"(context[activa]));
-    __asm__("pop {r4-r11, lr}");
-    __asm__("bx lr");
-}
-
-void CrearTarea(int id, void * entry_point) {
-    void * stack_pointer = stack[id] + STACK_SIZE;
-    struct context_s * context_pointer = stack_pointer - sizeof(struct context_s);
-
-    memset(context_pointer, 0, sizeof(struct context_s));
-    context_pointer->aditional.r7 = (uint32_t)(stack_pointer);
-    context_pointer->aditional.lr = 0xfffffff9;
-    context_pointer->interrupt.lr = (uint32_t)Error;
-    context_pointer->interrupt.xPSR = 0x01000000;
-    context_pointer->interrupt.pc = (uint32_t)entry_point;
-    context[id] = (uint32_t)(context_pointer);
+    TickSistema();
 }
 
 void Error(void) {
@@ -208,13 +195,21 @@ void Error(void) {
     }
 }
 
-void TareaA(void) {
+void TareaBoton(void * argumento) {
+    boton_t boton = argumento;
+
     while (1) {
-        if (DigitalInputGetState(board->boton_prueba)) {
-            DigitalOutputActivate(board->led_azul);
-        } else {
-            DigitalOutputDeactivate(board->led_azul);
+        if (boton->seguir) {
+            if (DigitalInputGetState(boton->entrada)) {
+                DigitalOutputActivate(boton->salida);
+            } else {
+                DigitalOutputDeactivate(boton->salida);
+            }
+        } else if (DigitalInputHasActivated(boton->entrada)) {
+            DigitalOutputToggle(boton->salida);
         }
+        /* Con mayor prioridad que el resto, la tarea debe ceder el procesador entre lecturas */
+        TareaDemorar(MS_TO_TICKS(BUTTON_PERIOD));
     }
 }
 
@@ -225,27 +220,46 @@ void TareaB(void) {
     }
 }
 
-void TareaC(void) {
+void TareaAnalisis(void) {
+    static uint32_t potencia[ADC_BLOCK_SIZE / 2];
+    int16_t * muestras;
+
     while (1) {
-        if (DigitalInputHasActivated(board->boton_cambiar)) {
-            DigitalOutputToggle(board->led_rojo);
-        }
+        muestras = AdcStreamRead(adquisicion);
+        FftReal(muestras, ADC_BLOCK_SIZE);
+        FftPower(muestras, potencia, ADC_BLOCK_SIZE);
+        vibracion = FftPeak(potencia, ADC_BLOCK_SIZE) * VIBRATION_RATE / ADC_BLOCK_SIZE;
     }
 }
 
 
 /* === Definiciones de funciones externas ================================== */
 int main(void) {
+    /* Procesador a la máxima frecuencia, antes de configurar los periféricos */
+    ClockSetProfile(CLOCK_PROFILE_PERFORMANCE);
+
     /* Configuración de los dispositivos de entrada/salida */
     board = BoardCreate();
 
-    /* Creación de las tareas del sistema */
-    CrearTarea(0, TareaA);
-    CrearTarea(1, TareaB);
-    CrearTarea(2, TareaC);
+    /* Carga de los parámetros guardados en la EEPROM */
+    ConfigLoad(parametros, PARAMETROS_CANTIDAD);
+
+    /* Datos de las tareas declaradas que dependen de la placa */
+    botones[0] = (struct boton_s){board->boton_prueba, board->led_azul, true};
+    botones[1] = (struct boton_s){board->boton_cambiar, board->led_rojo, false};
+
+    /* Adquisición del sensor de vibraciones que consume la tarea de análisis */
+    adquisicion = AdcStreamCreate(VIBRATION_CHANNEL, VIBRATION_RATE);
+    if (!adquisicion) {
+        Error();
+    }
+
+    /* Los botones se atienden primero, el análisis comparte la prioridad más baja con el led */
+    TareaAsignarPrioridad(0, 1);
+    TareaAsignarPrioridad(2, 1);
 
     /* Configuración del SysTick para producir los cambios de contexto */
-    SisTick_Init(5000);
+    SisTick_Init(TICKS_PER_SECOND);
 
     /* Espera de la primera interupción para arrancar el sistema */
     while (1) {
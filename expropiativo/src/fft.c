@@ -0,0 +1,300 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Fixed point spectral analysis definitions
+ **
+ ** La transformada compleja se calcula por decimación en frecuencia con mariposas de base 4, cada
+ ** una equivalente a dos etapas de base 2 con los factores de giro combinados. Guardando las
+ ** salidas de cada mariposa en el orden de base 2 el resultado queda en orden de bits invertidos,
+ ** por lo que una etapa final de base 2 completa los tamaños que no son potencia de 4 y un único
+ ** reordenamiento con la instrucción RBIT sirve para todos los tamaños.
+ **
+ ** Cada número complejo ocupa una palabra con la parte real en la mitad baja, de manera que las
+ ** sumas de las mariposas se hacen con SHADD16 y SHSUB16, que dividen por dos para evitar
+ ** desbordes, y cada producto complejo con SMUAD y SMUSDX.
+ **
+ ** \addtogroup dsp DSP
+ ** \brief Procesamiento digital de señales
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "fft.h"
+#include "simd.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Cantidad de factores de giro de la tabla, tres cuartos de circunferencia
+#define FFT_TWIDDLES (FFT_MAX_SIZE * 3 / 4)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/** Factores de giro W^k = cos(2πk/FFT_MAX_SIZE) - j sin(2πk/FFT_MAX_SIZE) en formato Q15, con el
+ ** coseno en la mitad baja y el seno en la mitad alta de cada palabra */
+static const uint32_t twiddles[FFT_TWIDDLES] = {
+    0x00007FFF, 0x01927FFD, 0x03247FF5, 0x04B67FE9, 0x06487FD8, 0x07D97FC1,
+    0x096A7FA6, 0x0AFB7F86, 0x0C8C7F61, 0x0E1C7F37, 0x0FAB7F09, 0x113A7ED5,
+    0x12C87E9C, 0x14557E5F, 0x15E27E1D, 0x176E7DD5, 0x18F97D89, 0x1A827D39,
+    0x1C0B7CE3, 0x1D937C88, 0x1F1A7C29, 0x209F7BC5, 0x22237B5C, 0x23A67AEE,
+    0x25287A7C, 0x26A87A05, 0x28267989, 0x29A37909, 0x2B1F7884, 0x2C9977FA,
+    0x2E11776B, 0x2F8776D8, 0x30FB7641, 0x326E75A5, 0x33DF7504, 0x354D745F,
+    0x36BA73B5, 0x38247307, 0x398C7254, 0x3AF2719D, 0x3C5670E2, 0x3DB87022,
+    0x3F176F5E, 0x40736E96, 0x41CE6DC9, 0x43256CF8, 0x447A6C23, 0x45CD6B4A,
+    0x471C6A6D, 0x4869698B, 0x49B468A6, 0x4AFB67BC, 0x4C3F66CF, 0x4D8165DD,
+    0x4EBF64E8, 0x4FFB63EE, 0x513362F1, 0x526861F0, 0x539B60EB, 0x54C95FE3,
+    0x55F55ED7, 0x571D5DC7, 0x58425CB3, 0x59645B9C, 0x5A825A82, 0x5B9C5964,
+    0x5CB35842, 0x5DC7571D, 0x5ED755F5, 0x5FE354C9, 0x60EB539B, 0x61F05268,
+    0x62F15133, 0x63EE4FFB, 0x64E84EBF, 0x65DD4D81, 0x66CF4C3F, 0x67BC4AFB,
+    0x68A649B4, 0x698B4869, 0x6A6D471C, 0x6B4A45CD, 0x6C23447A, 0x6CF84325,
+    0x6DC941CE, 0x6E964073, 0x6F5E3F17, 0x70223DB8, 0x70E23C56, 0x719D3AF2,
+    0x7254398C, 0x73073824, 0x73B536BA, 0x745F354D, 0x750433DF, 0x75A5326E,
+    0x764130FB, 0x76D82F87, 0x776B2E11, 0x77FA2C99, 0x78842B1F, 0x790929A3,
+    0x79892826, 0x7A0526A8, 0x7A7C2528, 0x7AEE23A6, 0x7B5C2223, 0x7BC5209F,
+    0x7C291F1A, 0x7C881D93, 0x7CE31C0B, 0x7D391A82, 0x7D8918F9, 0x7DD5176E,
+    0x7E1D15E2, 0x7E5F1455, 0x7E9C12C8, 0x7ED5113A, 0x7F090FAB, 0x7F370E1C,
+    0x7F610C8C, 0x7F860AFB, 0x7FA6096A, 0x7FC107D9, 0x7FD80648, 0x7FE904B6,
+    0x7FF50324, 0x7FFD0192, 0x7FFF0000, 0x7FFDFE6E, 0x7FF5FCDC, 0x7FE9FB4A,
+    0x7FD8F9B8, 0x7FC1F827, 0x7FA6F696, 0x7F86F505, 0x7F61F374, 0x7F37F1E4,
+    0x7F09F055, 0x7ED5EEC6, 0x7E9CED38, 0x7E5FEBAB, 0x7E1DEA1E, 0x7DD5E892,
+    0x7D89E707, 0x7D39E57E, 0x7CE3E3F5, 0x7C88E26D, 0x7C29E0E6, 0x7BC5DF61,
+    0x7B5CDDDD, 0x7AEEDC5A, 0x7A7CDAD8, 0x7A05D958, 0x7989D7DA, 0x7909D65D,
+    0x7884D4E1, 0x77FAD367, 0x776BD1EF, 0x76D8D079, 0x7641CF05, 0x75A5CD92,
+    0x7504CC21, 0x745FCAB3, 0x73B5C946, 0x7307C7DC, 0x7254C674, 0x719DC50E,
+    0x70E2C3AA, 0x7022C248, 0x6F5EC0E9, 0x6E96BF8D, 0x6DC9BE32, 0x6CF8BCDB,
+    0x6C23BB86, 0x6B4ABA33, 0x6A6DB8E4, 0x698BB797, 0x68A6B64C, 0x67BCB505,
+    0x66CFB3C1, 0x65DDB27F, 0x64E8B141, 0x63EEB005, 0x62F1AECD, 0x61F0AD98,
+    0x60EBAC65, 0x5FE3AB37, 0x5ED7AA0B, 0x5DC7A8E3, 0x5CB3A7BE, 0x5B9CA69C,
+    0x5A82A57E, 0x5964A464, 0x5842A34D, 0x571DA239, 0x55F5A129, 0x54C9A01D,
+    0x539B9F15, 0x52689E10, 0x51339D0F, 0x4FFB9C12, 0x4EBF9B18, 0x4D819A23,
+    0x4C3F9931, 0x4AFB9844, 0x49B4975A, 0x48699675, 0x471C9593, 0x45CD94B6,
+    0x447A93DD, 0x43259308, 0x41CE9237, 0x4073916A, 0x3F1790A2, 0x3DB88FDE,
+    0x3C568F1E, 0x3AF28E63, 0x398C8DAC, 0x38248CF9, 0x36BA8C4B, 0x354D8BA1,
+    0x33DF8AFC, 0x326E8A5B, 0x30FB89BF, 0x2F878928, 0x2E118895, 0x2C998806,
+    0x2B1F877C, 0x29A386F7, 0x28268677, 0x26A885FB, 0x25288584, 0x23A68512,
+    0x222384A4, 0x209F843B, 0x1F1A83D7, 0x1D938378, 0x1C0B831D, 0x1A8282C7,
+    0x18F98277, 0x176E822B, 0x15E281E3, 0x145581A1, 0x12C88164, 0x113A812B,
+    0x0FAB80F7, 0x0E1C80C9, 0x0C8C809F, 0x0AFB807A, 0x096A805A, 0x07D9803F,
+    0x06488028, 0x04B68017, 0x0324800B, 0x01928003, 0x00008001, 0xFE6E8003,
+    0xFCDC800B, 0xFB4A8017, 0xF9B88028, 0xF827803F, 0xF696805A, 0xF505807A,
+    0xF374809F, 0xF1E480C9, 0xF05580F7, 0xEEC6812B, 0xED388164, 0xEBAB81A1,
+    0xEA1E81E3, 0xE892822B, 0xE7078277, 0xE57E82C7, 0xE3F5831D, 0xE26D8378,
+    0xE0E683D7, 0xDF61843B, 0xDDDD84A4, 0xDC5A8512, 0xDAD88584, 0xD95885FB,
+    0xD7DA8677, 0xD65D86F7, 0xD4E1877C, 0xD3678806, 0xD1EF8895, 0xD0798928,
+    0xCF0589BF, 0xCD928A5B, 0xCC218AFC, 0xCAB38BA1, 0xC9468C4B, 0xC7DC8CF9,
+    0xC6748DAC, 0xC50E8E63, 0xC3AA8F1E, 0xC2488FDE, 0xC0E990A2, 0xBF8D916A,
+    0xBE329237, 0xBCDB9308, 0xBB8693DD, 0xBA3394B6, 0xB8E49593, 0xB7979675,
+    0xB64C975A, 0xB5059844, 0xB3C19931, 0xB27F9A23, 0xB1419B18, 0xB0059C12,
+    0xAECD9D0F, 0xAD989E10, 0xAC659F15, 0xAB37A01D, 0xAA0BA129, 0xA8E3A239,
+    0xA7BEA34D, 0xA69CA464, 0xA57EA57E, 0xA464A69C, 0xA34DA7BE, 0xA239A8E3,
+    0xA129AA0B, 0xA01DAB37, 0x9F15AC65, 0x9E10AD98, 0x9D0FAECD, 0x9C12B005,
+    0x9B18B141, 0x9A23B27F, 0x9931B3C1, 0x9844B505, 0x975AB64C, 0x9675B797,
+    0x9593B8E4, 0x94B6BA33, 0x93DDBB86, 0x9308BCDB, 0x9237BE32, 0x916ABF8D,
+    0x90A2C0E9, 0x8FDEC248, 0x8F1EC3AA, 0x8E63C50E, 0x8DACC674, 0x8CF9C7DC,
+    0x8C4BC946, 0x8BA1CAB3, 0x8AFCCC21, 0x8A5BCD92, 0x89BFCF05, 0x8928D079,
+    0x8895D1EF, 0x8806D367, 0x877CD4E1, 0x86F7D65D, 0x8677D7DA, 0x85FBD958,
+    0x8584DAD8, 0x8512DC5A, 0x84A4DDDD, 0x843BDF61, 0x83D7E0E6, 0x8378E26D,
+    0x831DE3F5, 0x82C7E57E, 0x8277E707, 0x822BE892, 0x81E3EA1E, 0x81A1EBAB,
+    0x8164ED38, 0x812BEEC6, 0x80F7F055, 0x80C9F1E4, 0x809FF374, 0x807AF505,
+    0x805AF696, 0x803FF827, 0x8028F9B8, 0x8017FB4A, 0x800BFCDC, 0x8003FE6E,
+};
+
+/* === Private function declarations =========================================================== */
+
+// Función que multiplica un numero complejo por un factor de giro
+static inline uint32_t ComplexMultiply(uint32_t value, uint32_t twiddle);
+
+// Función que calcula la transformada compleja en el mismo lugar
+static void FftComplex(uint32_t * data, uint16_t size);
+
+// Función que reordena el resultado de la transformada compleja
+static void FftBitReverse(uint32_t * data, uint16_t size);
+
+// Función que separa la transformada real a partir de la transformada compleja
+static void FftSplit(uint32_t * data, uint16_t size);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static inline uint32_t ComplexMultiply(uint32_t value, uint32_t twiddle) {
+    int32_t real = (int32_t)__SMUAD(value, twiddle) >> 15;
+    int32_t imaginary = (int32_t)__SMUSDX(twiddle, value) >> 15;
+
+    return __PKHBT(real, imaginary, 16);
+}
+
+static void FftComplex(uint32_t * data, uint16_t size) {
+    uint32_t * point;
+    uint32_t a, b, c, d, sum_ac, difference_ac, sum_bd, difference_bd;
+    uint16_t length, quarter, stride;
+
+    for (length = size; length >= 4; length /= 4) {
+        quarter = length / 4;
+        stride = FFT_MAX_SIZE / length;
+        for (uint16_t start = 0; start < size; start += length) {
+            for (uint16_t index = 0; index < quarter; index++) {
+                point = &data[start + index];
+                a = point[0];
+                b = point[quarter];
+                c = point[2 * quarter];
+                d = point[3 * quarter];
+
+                sum_ac = __SHADD16(a, c);
+                difference_ac = __SHSUB16(a, c);
+                sum_bd = __SHADD16(b, d);
+                difference_bd = __SHSUB16(b, d);
+
+                /* Las salidas se guardan en el orden de dos etapas de base 2 */
+                point[0] = __SHADD16(sum_ac, sum_bd);
+                point[quarter] =
+                    ComplexMultiply(__SHSUB16(sum_ac, sum_bd), twiddles[2 * index * stride]);
+                point[2 * quarter] = ComplexMultiply(__SHSAX(difference_ac, difference_bd),
+                                                     twiddles[index * stride]);
+                point[3 * quarter] = ComplexMultiply(__SHASX(difference_ac, difference_bd),
+                                                     twiddles[3 * index * stride]);
+            }
+        }
+    }
+
+    if (length == 2) {
+        for (uint16_t start = 0; start < size; start += 2) {
+            a = data[start];
+            b = data[start + 1];
+            data[start] = __SHADD16(a, b);
+            data[start + 1] = __SHSUB16(a, b);
+        }
+    }
+}
+
+static void FftBitReverse(uint32_t * data, uint16_t size) {
+    uint32_t shift = __CLZ(size) + 1;
+    uint32_t swap, other;
+
+    for (uint32_t index = 1; index + 1 < size; index++) {
+        other = __RBIT(index) >> shift;
+        if (other > index) {
+            swap = data[index];
+            data[index] = data[other];
+            data[other] = swap;
+        }
+    }
+}
+
+static void FftSplit(uint32_t * data, uint16_t size) {
+    uint16_t half = size / 2;
+    uint16_t stride = FFT_MAX_SIZE / size;
+    uint32_t first, second, even, odd, rotated;
+    int32_t real, imaginary;
+
+    /* X[0] y X[N/2] son reales y comparten una palabra */
+    real = (int16_t)data[0];
+    imaginary = (int16_t)(data[0] >> 16);
+    data[0] = __PKHBT((real + imaginary) >> 1, (real - imaginary) >> 1, 16);
+
+    for (uint16_t index = 1; index <= half / 2; index++) {
+        first = data[index];
+        second = __PKHBT(data[half - index], __QSUB16(0, data[half - index]), 0);
+
+        even = __SHADD16(first, second);
+        odd = __SHSUB16(first, second);
+        /* Rotación de la parte impar por -j antes de aplicar el factor de giro */
+        rotated = __PKHBT(odd >> 16, __QSUB16(0, odd), 16);
+        rotated = ComplexMultiply(rotated, twiddles[index * stride]);
+
+        data[index] = __SHADD16(even, rotated);
+        if (index != half - index) {
+            first = __SHSUB16(even, rotated);
+            data[half - index] = __PKHBT(first, __QSUB16(0, first), 0);
+        }
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+bool FftReal(int16_t * samples, uint16_t size) {
+    uint32_t * data = (uint32_t *)samples;
+
+    if ((size < FFT_MIN_SIZE) || (size > FFT_MAX_SIZE) || (size & (size - 1))) {
+        return false;
+    }
+
+    FftComplex(data, size / 2);
+    FftBitReverse(data, size / 2);
+    FftSplit(data, size);
+    return true;
+}
+
+void FftPower(const int16_t * spectrum, uint32_t * power, uint16_t size) {
+    uint32_t value;
+
+    power[0] = spectrum[0] * spectrum[0];
+    for (uint16_t index = 1; index < size / 2; index++) {
+        value = SimdReadPair(&spectrum[2 * index]);
+        power[index] = __SMUAD(value, value);
+    }
+}
+
+uint16_t FftPeak(const uint32_t * power, uint16_t size) {
+    uint16_t peak = 1;
+
+    for (uint16_t index = 2; index < size / 2; index++) {
+        if (power[index] > power[peak]) {
+            peak = index;
+        }
+    }
+    return peak;
+}
+
+uint32_t FftBenchmark(uint16_t size) {
+    static int16_t samples[FFT_MAX_SIZE] __attribute__((aligned(4)));
+    uint32_t start, cycles;
+
+    BENCHMARK_INIT();
+
+    for (uint16_t index = 0; index < size && index < FFT_MAX_SIZE; index++) {
+        samples[index] = (index & 4) ? 8192 : -8192;
+    }
+
+    start = BENCHMARK_NOW();
+    cycles = FftReal(samples, size) ? BENCHMARK_NOW() - start : 0;
+    return cycles;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
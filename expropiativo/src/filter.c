@@ -0,0 +1,468 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Fixed point digital filters definitions
+ **
+ ** Los núcleos de cálculo operan con pares de muestras de 16 bits empaquetadas en una palabra y
+ ** utilizan las instrucciones SIMD del Cortex-M4: SMLALD y SMLAD suman dos productos por
+ ** instrucción y QADD16 suma con saturación dos muestras a la vez. Cuando se compila para un
+ ** procesador sin estas instrucciones las mismas se emulan en C, lo que permite verificar en el
+ ** equipo de desarrollo que los resultados coinciden con los de las versiones de referencia.
+ **
+ ** \addtogroup dsp DSP
+ ** \brief Procesamiento digital de señales
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "filter.h"
+#include "simd.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Cantidad de coeficientes de cada sección de segundo orden
+#define BIQUAD_COEFFICIENTS 5
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de un filtro FIR
+struct fir_s {
+    //! Coeficientes en orden inverso, con un cero adelante si la cantidad es impar
+    int16_t coefficients[FILTER_MAX_TAPS + 1];
+    //! Ultimas taps - 1 muestras de la pasada anterior seguidas por el bloque actual
+    int16_t state[FILTER_MAX_TAPS + FILTER_BLOCK_SIZE];
+    uint16_t taps;   //!< Cantidad de coeficientes, redondeada a un numero par
+    bool allocated;  //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Estructura para almacenar una sección de segundo orden en formato Q15
+struct biquad_stage_s {
+    int16_t b0;  //!< Coeficiente de la muestra actual
+    uint32_t b;  //!< Coeficientes b1 y b2 empaquetados
+    uint32_t a;  //!< Coeficientes a1 y a2 empaquetados
+    uint32_t x;  //!< Entradas x[n-1] y x[n-2] empaquetadas
+    uint32_t y;  //!< Salidas y[n-1] y y[n-2] empaquetadas
+};
+
+//! Estructura para almacenar el descriptor de un filtro IIR en formato Q15
+struct biquad_s {
+    struct biquad_stage_s stages[BIQUAD_MAX_STAGES]; //!< Secciones de segundo orden
+    uint8_t count;   //!< Cantidad de secciones en uso
+    uint8_t shift;   //!< Escala de los coeficientes
+    bool allocated;  //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Estructura para almacenar una sección de segundo orden en formato Q31
+struct biquad_q31_stage_s {
+    int32_t coefficients[BIQUAD_COEFFICIENTS]; //!< Coeficientes b0, b1, b2, a1 y a2
+    int32_t x[2];                              //!< Entradas x[n-1] y x[n-2]
+    int32_t y[2];                              //!< Salidas y[n-1] y y[n-2]
+};
+
+//! Estructura para almacenar el descriptor de un filtro IIR en formato Q31
+struct biquad_q31_s {
+    struct biquad_q31_stage_s stages[BIQUAD_MAX_STAGES]; //!< Secciones de segundo orden
+    uint8_t count;   //!< Cantidad de secciones en uso
+    uint8_t shift;   //!< Escala de los coeficientes
+    bool allocated;  //!< Bandera para indicar que el descriptor esta en uso
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+// Función para asignar un descriptor para crear un nuevo filtro FIR
+static fir_t FirAllocate(void);
+
+// Función para asignar un descriptor para crear un nuevo filtro IIR en formato Q15
+static biquad_t BiquadAllocate(void);
+
+// Función para asignar un descriptor para crear un nuevo filtro IIR en formato Q31
+static biquad_q31_t BiquadQ31Allocate(void);
+
+// Versión en C del filtro FIR utilizada como referencia
+static void FirProcessReference(fir_t fir, const int16_t * input, int16_t * output,
+                                uint16_t count);
+
+// Versión en C del filtro IIR en formato Q15 utilizada como referencia
+static void BiquadProcessReference(biquad_t biquad, const int16_t * input, int16_t * output,
+                                   uint16_t count);
+
+// Versión en C de la suma saturada utilizada como referencia
+static void FilterAddReference(const int16_t * first, const int16_t * second, int16_t * output,
+                               uint16_t count);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static fir_t FirAllocate(void) {
+    fir_t fir = NULL;
+
+    static struct fir_s instances[FIR_INSTANCES] = {0};
+
+    for (int index = 0; index < FIR_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            fir = &instances[index];
+            break;
+        }
+    }
+    return fir;
+}
+
+static biquad_t BiquadAllocate(void) {
+    biquad_t biquad = NULL;
+
+    static struct biquad_s instances[BIQUAD_INSTANCES] = {0};
+
+    for (int index = 0; index < BIQUAD_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            biquad = &instances[index];
+            break;
+        }
+    }
+    return biquad;
+}
+
+static biquad_q31_t BiquadQ31Allocate(void) {
+    biquad_q31_t biquad = NULL;
+
+    static struct biquad_q31_s instances[BIQUAD_INSTANCES] = {0};
+
+    for (int index = 0; index < BIQUAD_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            biquad = &instances[index];
+            break;
+        }
+    }
+    return biquad;
+}
+
+static void FirProcessReference(fir_t fir, const int16_t * input, int16_t * output,
+                                uint16_t count) {
+    const int16_t * coefficients = fir->coefficients;
+    int16_t * state = fir->state;
+    uint16_t block;
+    int64_t sum;
+
+    while (count) {
+        block = (count > FILTER_BLOCK_SIZE) ? FILTER_BLOCK_SIZE : count;
+        memcpy(&state[fir->taps - 1], input, block * sizeof(int16_t));
+
+        for (int sample = 0; sample < block; sample++) {
+            sum = 0;
+            for (int tap = 0; tap < fir->taps; tap++) {
+                sum += (int32_t)coefficients[tap] * state[sample + tap];
+            }
+            output[sample] = __SSAT((int32_t)(sum >> 15), 16);
+        }
+
+        memmove(state, &state[block], (fir->taps - 1) * sizeof(int16_t));
+        input += block;
+        output += block;
+        count -= block;
+    }
+}
+
+static void BiquadProcessReference(biquad_t biquad, const int16_t * input, int16_t * output,
+                                   uint16_t count) {
+    struct biquad_stage_s * stage;
+    int32_t sample, sum;
+
+    for (int index = 0; index < count; index++) {
+        sample = input[index];
+        for (int section = 0; section < biquad->count; section++) {
+            stage = &biquad->stages[section];
+            sum = stage->b0 * sample;
+            sum += (int16_t)stage->b * (int16_t)stage->x;
+            sum += (int16_t)(stage->b >> 16) * (int16_t)(stage->x >> 16);
+            sum += (int16_t)stage->a * (int16_t)stage->y;
+            sum += (int16_t)(stage->a >> 16) * (int16_t)(stage->y >> 16);
+
+            stage->x = (stage->x << 16) | (uint16_t)sample;
+            sample = __SSAT(sum >> (15 - biquad->shift), 16);
+            stage->y = (stage->y << 16) | (uint16_t)sample;
+        }
+        output[index] = sample;
+    }
+}
+
+static void FilterAddReference(const int16_t * first, const int16_t * second, int16_t * output,
+                               uint16_t count) {
+    for (int index = 0; index < count; index++) {
+        output[index] = __SSAT(first[index] + second[index], 16);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+fir_t FirCreate(const int16_t * coefficients, uint16_t taps) {
+    fir_t fir = NULL;
+
+    if ((taps > 0) && (taps <= FILTER_MAX_TAPS)) {
+        fir = FirAllocate();
+    }
+
+    if (fir) {
+        fir->taps = (taps + 1) & ~1;
+        memset(fir->coefficients, 0, sizeof(fir->coefficients));
+        memset(fir->state, 0, sizeof(fir->state));
+        for (int tap = 0; tap < taps; tap++) {
+            fir->coefficients[fir->taps - 1 - tap] = coefficients[tap];
+        }
+    }
+    return fir;
+}
+
+void FirProcess(fir_t fir, const int16_t * input, int16_t * output, uint16_t count) {
+    const int16_t * coefficients = fir->coefficients;
+    int16_t * state = fir->state;
+    uint16_t block;
+    uint64_t sum;
+
+    while (count) {
+        block = (count > FILTER_BLOCK_SIZE) ? FILTER_BLOCK_SIZE : count;
+        memcpy(&state[fir->taps - 1], input, block * sizeof(int16_t));
+
+        for (int sample = 0; sample < block; sample++) {
+            sum = 0;
+            for (int tap = 0; tap < fir->taps; tap += 2) {
+                sum = __SMLALD(SimdReadPair(&coefficients[tap]), SimdReadPair(&state[sample + tap]),
+                               sum);
+            }
+            output[sample] = __SSAT((int32_t)((int64_t)sum >> 15), 16);
+        }
+
+        memmove(state, &state[block], (fir->taps - 1) * sizeof(int16_t));
+        input += block;
+        output += block;
+        count -= block;
+    }
+}
+
+biquad_t BiquadCreate(const int16_t * coefficients, uint8_t stages, uint8_t shift) {
+    biquad_t biquad = NULL;
+    const int16_t * values;
+
+    if ((stages > 0) && (stages <= BIQUAD_MAX_STAGES) && (shift < 15)) {
+        biquad = BiquadAllocate();
+    }
+
+    if (biquad) {
+        biquad->count = stages;
+        biquad->shift = shift;
+        for (int section = 0; section < stages; section++) {
+            values = &coefficients[section * BIQUAD_COEFFICIENTS];
+            biquad->stages[section].b0 = values[0];
+            biquad->stages[section].b = __PKHBT((uint16_t)values[1], (uint16_t)values[2], 16);
+            biquad->stages[section].a = __PKHBT((uint16_t)values[3], (uint16_t)values[4], 16);
+            biquad->stages[section].x = 0;
+            biquad->stages[section].y = 0;
+        }
+    }
+    return biquad;
+}
+
+void BiquadProcess(biquad_t biquad, const int16_t * input, int16_t * output, uint16_t count) {
+    struct biquad_stage_s * stage;
+    int32_t sample, sum;
+
+    for (int index = 0; index < count; index++) {
+        sample = input[index];
+        for (int section = 0; section < biquad->count; section++) {
+            stage = &biquad->stages[section];
+            sum = stage->b0 * sample;
+            sum = __SMLAD(stage->b, stage->x, sum);
+            sum = __SMLAD(stage->a, stage->y, sum);
+
+            /* La muestra nueva pasa a la mitad baja y la anterior a la alta */
+            stage->x = __PKHBT(sample, stage->x, 16);
+            sample = __SSAT(sum >> (15 - biquad->shift), 16);
+            stage->y = __PKHBT(sample, stage->y, 16);
+        }
+        output[index] = sample;
+    }
+}
+
+biquad_q31_t BiquadQ31Create(const int32_t * coefficients, uint8_t stages, uint8_t shift) {
+    biquad_q31_t biquad = NULL;
+
+    if ((stages > 0) && (stages <= BIQUAD_MAX_STAGES) && (shift < 31)) {
+        biquad = BiquadQ31Allocate();
+    }
+
+    if (biquad) {
+        biquad->count = stages;
+        biquad->shift = shift;
+        memset(biquad->stages, 0, sizeof(biquad->stages));
+        for (int section = 0; section < stages; section++) {
+            memcpy(biquad->stages[section].coefficients,
+                   &coefficients[section * BIQUAD_COEFFICIENTS],
+                   sizeof(biquad->stages[section].coefficients));
+        }
+    }
+    return biquad;
+}
+
+void BiquadQ31Process(biquad_q31_t biquad, const int32_t * input, int32_t * output,
+                      uint16_t count) {
+    struct biquad_q31_stage_s * stage;
+    int32_t sample;
+    int64_t sum;
+
+    for (int index = 0; index < count; index++) {
+        sample = input[index];
+        for (int section = 0; section < biquad->count; section++) {
+            stage = &biquad->stages[section];
+
+            /* Cada producto se acumula con una instrucción SMLAL */
+            sum = (int64_t)stage->coefficients[0] * sample;
+            sum += (int64_t)stage->coefficients[1] * stage->x[0];
+            sum += (int64_t)stage->coefficients[2] * stage->x[1];
+            sum += (int64_t)stage->coefficients[3] * stage->y[0];
+            sum += (int64_t)stage->coefficients[4] * stage->y[1];
+
+            stage->x[1] = stage->x[0];
+            stage->x[0] = sample;
+            sample = (int32_t)(sum >> (31 - biquad->shift));
+            stage->y[1] = stage->y[0];
+            stage->y[0] = sample;
+        }
+        output[index] = sample;
+    }
+}
+
+void FilterAdd(const int16_t * first, const int16_t * second, int16_t * output, uint16_t count) {
+    int index;
+
+    for (index = 0; index + 1 < count; index += 2) {
+        SimdWritePair(&output[index],
+                      __QADD16(SimdReadPair(&first[index]), SimdReadPair(&second[index])));
+    }
+    if (index < count) {
+        output[index] = __SSAT(first[index] + second[index], 16);
+    }
+}
+
+void FilterBenchmark(filter_benchmark_t result) {
+    static const int16_t taps[] = {-327, 0, 2621, 6553, 9830, 6553, 2621, 0, -327};
+    static const int16_t sections[] = {4096, 8192, 4096, 22938, -9830};
+    static int16_t input[FILTER_BLOCK_SIZE];
+    static int16_t output[FILTER_BLOCK_SIZE];
+    static int16_t reference[FILTER_BLOCK_SIZE];
+    static int16_t addend[FILTER_BLOCK_SIZE];
+    fir_t fir;
+    biquad_t biquad;
+    uint32_t start;
+
+    BENCHMARK_INIT();
+    memset(result, 0, sizeof(*result));
+
+    for (int index = 0; index < FILTER_BLOCK_SIZE; index++) {
+        input[index] = (index & 8) ? 4096 : -4096;
+    }
+
+    fir = FirCreate(taps, sizeof(taps) / sizeof(taps[0]));
+    biquad = BiquadCreate(sections, 1, 1);
+    if (!fir || !biquad) {
+        return;
+    }
+
+    /* Cada versión arranca con el estado en cero para que las salidas sean comparables */
+    memset(fir->state, 0, sizeof(fir->state));
+    start = BENCHMARK_NOW();
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        FirProcess(fir, input, output, FILTER_BLOCK_SIZE);
+    }
+    result->fir = BENCHMARK_NOW() - start;
+
+    memset(fir->state, 0, sizeof(fir->state));
+    start = BENCHMARK_NOW();
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        FirProcessReference(fir, input, reference, FILTER_BLOCK_SIZE);
+    }
+    result->fir_reference = BENCHMARK_NOW() - start;
+    result->mismatch = result->mismatch || memcmp(output, reference, sizeof(output));
+
+    for (int section = 0; section < biquad->count; section++) {
+        biquad->stages[section].x = 0;
+        biquad->stages[section].y = 0;
+    }
+    start = BENCHMARK_NOW();
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        BiquadProcess(biquad, input, output, FILTER_BLOCK_SIZE);
+    }
+    result->biquad = BENCHMARK_NOW() - start;
+
+    for (int section = 0; section < biquad->count; section++) {
+        biquad->stages[section].x = 0;
+        biquad->stages[section].y = 0;
+    }
+    start = BENCHMARK_NOW();
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        BiquadProcessReference(biquad, input, reference, FILTER_BLOCK_SIZE);
+    }
+    result->biquad_reference = BENCHMARK_NOW() - start;
+    result->mismatch = result->mismatch || memcmp(output, reference, sizeof(output));
+
+    /* La suma usa la salida del filtro como segunda entrada, sin escribir sobre ella */
+    memcpy(addend, output, sizeof(output));
+    start = BENCHMARK_NOW();
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        FilterAdd(input, addend, output, FILTER_BLOCK_SIZE);
+    }
+    result->add = BENCHMARK_NOW() - start;
+
+    start = BENCHMARK_NOW();
+    for (int iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        FilterAddReference(input, addend, reference, FILTER_BLOCK_SIZE);
+    }
+    result->add_reference = BENCHMARK_NOW() - start;
+    result->mismatch = result->mismatch || memcmp(output, reference, sizeof(output));
+
+    fir->allocated = false;
+    biquad->allocated = false;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
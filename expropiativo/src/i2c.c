@@ -0,0 +1,328 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Interrupt driven I2C master definitions
+ **
+ ** Las transacciones se encolan en un buffer circular y las ejecuta la interrupción del
+ ** controlador, que avanza una máquina de estados con cada código de estado del bus. Cada
+ ** transacción arranca un temporizador del núcleo y, si vence antes de que termine, se aborta y
+ ** se reinicia el controlador. Los terminales dedicados de I2C0 no permiten generar pulsos de
+ ** reloj por software, por lo que la recuperación del bus se limita a una condición de fin y a
+ ** reiniciar el controlador.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "i2c.h"
+#include "chip.h"
+#include "kernel.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Condición de inicio transmitida
+#define I2C_STAT_START 0x08
+
+//! Condición de inicio repetida transmitida
+#define I2C_STAT_REPEATED_START 0x10
+
+//! Dirección de escritura reconocida por el dispositivo
+#define I2C_STAT_SLAW_ACK 0x18
+
+//! Dirección de escritura no reconocida por el dispositivo
+#define I2C_STAT_SLAW_NACK 0x20
+
+//! Dato transmitido y reconocido por el dispositivo
+#define I2C_STAT_DATA_ACK 0x28
+
+//! Dato transmitido y no reconocido por el dispositivo
+#define I2C_STAT_DATA_NACK 0x30
+
+//! Arbitraje perdido durante la transmisión
+#define I2C_STAT_ARBITRATION_LOST 0x38
+
+//! Dirección de lectura reconocida por el dispositivo
+#define I2C_STAT_SLAR_ACK 0x40
+
+//! Dirección de lectura no reconocida por el dispositivo
+#define I2C_STAT_SLAR_NACK 0x48
+
+//! Dato recibido y reconocido
+#define I2C_STAT_RX_ACK 0x50
+
+//! Último dato recibido y no reconocido
+#define I2C_STAT_RX_NACK 0x58
+
+//! Condición de inicio o fin fuera de lugar
+#define I2C_STAT_BUS_ERROR 0x00
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de un bus I2C
+struct i2c_bus_s {
+    LPC_I2C_T * i2c;                          //!< Controlador I2C del bus
+    i2c_transfer_t queue[I2C_QUEUE_LENGTH];   //!< Transacciones pendientes
+    uint8_t head;                             //!< Posición de la transacción en curso
+    uint8_t count;                            //!< Cantidad de transacciones en la cola
+    uint16_t index;                           //!< Posición del próximo byte de la transacción
+    bool reading;                             //!< La transacción está en la fase de lectura
+    uint32_t deadline;                        //!< Tiempo del sistema en que vence la transacción
+    temporizador_t timer;                     //!< Temporizador del tiempo máximo
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Bus I2C disponible en el conector de la placa
+static struct i2c_bus_s i2c0 = {
+    .i2c = LPC_I2C0,
+};
+
+/* === Private function declarations =========================================================== */
+
+// Función que arranca la transacción ubicada al frente de la cola
+static void I2cStart(struct i2c_bus_s * bus);
+
+// Función que termina la transacción en curso y arranca la siguiente
+static void I2cFinish(struct i2c_bus_s * bus, i2c_status_t status);
+
+// Función que libera el bus y reinicia el controlador después de un error
+static void I2cRecover(struct i2c_bus_s * bus);
+
+// Función que atiende el vencimiento del tiempo máximo de una transacción
+static void I2cTimeout(void * data);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void I2cStart(struct i2c_bus_s * bus) {
+    i2c_transfer_t transfer = bus->queue[bus->head];
+    uint32_t ticks = MS_TO_TICKS(transfer->timeout ? transfer->timeout : I2C_DEFAULT_TIMEOUT);
+
+    bus->index = 0;
+    bus->reading = (transfer->tx_length == 0);
+    bus->deadline = TiempoSistema() + ticks;
+    TemporizadorIniciar(bus->timer, ticks);
+    bus->i2c->CONSET = I2C_CON_STA;
+}
+
+static void I2cFinish(struct i2c_bus_s * bus, i2c_status_t status) {
+    i2c_transfer_t transfer = bus->queue[bus->head];
+
+    TemporizadorDetener(bus->timer);
+    transfer->status = status;
+    if (transfer->task < TASK_COUNT) {
+        TareaNotificar(transfer->task);
+    }
+
+    bus->head = (bus->head + 1) % I2C_QUEUE_LENGTH;
+    bus->count--;
+    if (bus->count) {
+        /* Si hay una condición de fin pendiente el controlador la transmite antes del inicio */
+        I2cStart(bus);
+    }
+}
+
+static void I2cRecover(struct i2c_bus_s * bus) {
+    bus->i2c->CONCLR = I2C_CON_I2EN | I2C_CON_STA | I2C_CON_AA | I2C_CON_SI;
+    bus->i2c->CONSET = I2C_CON_I2EN | I2C_CON_STO;
+}
+
+static void I2cTimeout(void * data) {
+    struct i2c_bus_s * bus = data;
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    /* La interrupción del bus pudo terminar la transacción antes de la sección crítica */
+    if (bus->count && ((int32_t)(TiempoSistema() - bus->deadline) >= 0)) {
+        I2cRecover(bus);
+        I2cFinish(bus, I2C_TIMEOUT);
+    }
+    __set_PRIMASK(estado);
+}
+
+/* === Public function implementation ========================================================= */
+
+void I2C0_IRQHandler(void) {
+    struct i2c_bus_s * bus = &i2c0;
+    i2c_transfer_t transfer = bus->queue[bus->head];
+    uint32_t status = bus->i2c->STAT & I2C_STAT_CODE_BITMASK;
+
+    if (bus->count == 0) {
+        bus->i2c->CONCLR = I2C_CON_SI;
+        return;
+    }
+
+    switch (status) {
+    case I2C_STAT_START:
+    case I2C_STAT_REPEATED_START:
+        bus->i2c->DAT = (transfer->address << 1) | (bus->reading ? 1 : 0);
+        bus->i2c->CONCLR = I2C_CON_STA | I2C_CON_SI;
+        break;
+
+    case I2C_STAT_SLAW_ACK:
+    case I2C_STAT_DATA_ACK:
+        if (bus->index < transfer->tx_length) {
+            bus->i2c->DAT = transfer->tx[bus->index++];
+            bus->i2c->CONCLR = I2C_CON_SI;
+        } else if (transfer->rx_length) {
+            bus->index = 0;
+            bus->reading = true;
+            bus->i2c->CONSET = I2C_CON_STA;
+            bus->i2c->CONCLR = I2C_CON_SI;
+        } else {
+            bus->i2c->CONSET = I2C_CON_STO;
+            bus->i2c->CONCLR = I2C_CON_SI;
+            I2cFinish(bus, I2C_OK);
+        }
+        break;
+
+    case I2C_STAT_SLAW_NACK:
+    case I2C_STAT_DATA_NACK:
+    case I2C_STAT_SLAR_NACK:
+        bus->i2c->CONSET = I2C_CON_STO;
+        bus->i2c->CONCLR = I2C_CON_SI;
+        I2cFinish(bus, I2C_NACK);
+        break;
+
+    case I2C_STAT_ARBITRATION_LOST:
+        /* El bus queda en manos del otro maestro, no se transmite la condición de fin */
+        bus->i2c->CONCLR = I2C_CON_SI;
+        I2cFinish(bus, I2C_ARBITRATION_LOST);
+        break;
+
+    case I2C_STAT_SLAR_ACK:
+        if (transfer->rx_length > 1) {
+            bus->i2c->CONSET = I2C_CON_AA;
+        } else {
+            bus->i2c->CONCLR = I2C_CON_AA;
+        }
+        bus->i2c->CONCLR = I2C_CON_SI;
+        break;
+
+    case I2C_STAT_RX_ACK:
+        transfer->rx[bus->index++] = bus->i2c->DAT;
+        /* El último byte no se reconoce para indicar al dispositivo el fin de la lectura */
+        if (bus->index + 1 < transfer->rx_length) {
+            bus->i2c->CONSET = I2C_CON_AA;
+        } else {
+            bus->i2c->CONCLR = I2C_CON_AA;
+        }
+        bus->i2c->CONCLR = I2C_CON_SI;
+        break;
+
+    case I2C_STAT_RX_NACK:
+        transfer->rx[bus->index++] = bus->i2c->DAT;
+        bus->i2c->CONSET = I2C_CON_STO;
+        bus->i2c->CONCLR = I2C_CON_SI;
+        I2cFinish(bus, I2C_OK);
+        break;
+
+    case I2C_STAT_BUS_ERROR:
+        I2cRecover(bus);
+        I2cFinish(bus, I2C_BUS_ERROR);
+        break;
+
+    default:
+        bus->i2c->CONCLR = I2C_CON_SI;
+        break;
+    }
+}
+
+bool I2cInit(uint32_t bitrate) {
+    if (i2c0.timer) {
+        return false;
+    }
+    i2c0.timer = TemporizadorCrear(I2cTimeout, &i2c0);
+    if (!i2c0.timer) {
+        return false;
+    }
+
+    Chip_SCU_I2C0PinConfig(I2C0_STANDARD_FAST_MODE);
+    Chip_I2C_Init(I2C0);
+    Chip_I2C_SetClockRate(I2C0, bitrate);
+    i2c0.i2c->CONCLR = I2C_CON_STA | I2C_CON_STO | I2C_CON_AA | I2C_CON_SI;
+    i2c0.i2c->CONSET = I2C_CON_I2EN;
+
+    NVIC_ClearPendingIRQ(I2C0_IRQn);
+    NVIC_EnableIRQ(I2C0_IRQn);
+    return true;
+}
+
+bool I2cSubmit(i2c_transfer_t transfer) {
+    bool result = false;
+    uint32_t estado;
+
+    if ((transfer->tx_length == 0) && (transfer->rx_length == 0)) {
+        return false;
+    }
+    transfer->status = I2C_PENDING;
+    transfer->task = TareaActual();
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    if (i2c0.count < I2C_QUEUE_LENGTH) {
+        i2c0.queue[(i2c0.head + i2c0.count) % I2C_QUEUE_LENGTH] = transfer;
+        i2c0.count++;
+        if (i2c0.count == 1) {
+            I2cStart(&i2c0);
+        }
+        result = true;
+    }
+    __set_PRIMASK(estado);
+
+    return result;
+}
+
+i2c_status_t I2cWait(i2c_transfer_t transfer) {
+    while (transfer->status == I2C_PENDING) {
+        TareaEsperarNotificacion();
+    }
+    return transfer->status;
+}
+
+i2c_status_t I2cTransfer(i2c_transfer_t transfer) {
+    if (!I2cSubmit(transfer)) {
+        return I2C_PENDING;
+    }
+    return I2cWait(transfer);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,1116 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Definiciones del núcleo expropiativo
+ **
+ ** Planificador round robin con cambio de contexto expropiativo. La interrupción periódica del
+ ** sistema solo solicita el cambio de contexto, que se realiza en la interrupción PendSV de menor
+ ** prioridad, de manera que una tarea que se bloquea o una interrupción que desbloquea a una
+ ** tarea pueden forzar el cambio sin esperar al siguiente tick.
+ **
+ ** Cada descriptor de tarea incluye el enlace con el que se ubica, sin reservar memoria, en la
+ ** lista de tareas listas o en la lista de espera de un semaforo, ambas ordenadas por prioridad.
+ ** Los temporizadores en marcha usan las mismas listas, ordenadas por tick de vencimiento.
+ **
+ ** Las tareas se agrupan en particiones temporales con un presupuesto de ticks por marco
+ ** principal, que se descuenta en cada tick. Las tareas de una partición que agotó su presupuesto
+ ** no reciben el procesador hasta el siguiente marco.
+ **
+ ** \addtogroup kernel Kernel
+ ** \brief Núcleo de planificación expropiativo
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "kernel.h"
+#include "chip.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Obtiene el puntero a la estructura que contiene un nodo de lista
+#define CONTENEDOR(nodo, tipo, campo) ((tipo *)((uint8_t *)(nodo) - offsetof(tipo, campo)))
+
+//! Inicializador de una lista vacía, cuya cabecera apunta a si misma
+#define LISTA_VACIA(lista)                                                                         \
+    {                                                                                              \
+        .cabecera = {.siguiente = &(lista).cabecera, .anterior = &(lista).cabecera }               \
+    }
+
+//! Llamada al gancho de salida de una tarea, vacía si la aplicación no lo define
+#ifdef KERNEL_HOOK_SWITCH_OUT
+    #define GANCHO_SALIDA(id) KERNEL_HOOK_SWITCH_OUT(id)
+#else
+    #define GANCHO_SALIDA(id)
+#endif
+
+//! Llamada al gancho de entrada de una tarea, vacía si la aplicación no lo define
+#ifdef KERNEL_HOOK_SWITCH_IN
+    #define GANCHO_ENTRADA(id) KERNEL_HOOK_SWITCH_IN(id)
+#else
+    #define GANCHO_ENTRADA(id)
+#endif
+
+//! Llamada al gancho del tick del sistema, vacía si la aplicación no lo define
+#ifdef KERNEL_HOOK_TICK
+    #define GANCHO_TICK() KERNEL_HOOK_TICK()
+#else
+    #define GANCHO_TICK()
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+typedef uint8_t stack_t[STACK_SIZE];
+
+typedef struct tarea_contexto_s * context_t;
+
+//! Estados posibles de una tarea
+typedef enum {
+    TAREA_SUSPENDIDA = 0, //!< La tarea no fue creada o no puede ejecutarse
+    TAREA_LISTA,          //!< La tarea puede recibir tiempo de procesador
+    TAREA_BLOQUEADA,      //!< La tarea espera por un objeto del núcleo
+} estado_t;
+
+//! Enlace de un elemento en una lista doblemente enlazada intrusiva
+typedef struct nodo_s {
+    struct nodo_s * siguiente; //!< Nodo siguiente de la lista, NULL si no está en una lista
+    struct nodo_s * anterior;  //!< Nodo anterior de la lista
+    uint32_t clave;            //!< Clave de orden, las menores se ubican primero en la lista
+} * nodo_t;
+
+//! Lista doblemente enlazada circular con un nodo de cabecera
+typedef struct lista_s {
+    struct nodo_s cabecera; //!< Nodo de cabecera, no pertenece a ningún elemento
+} * lista_t;
+
+//! Estructura para almacenar el descriptor de una tarea
+struct tarea_s {
+    uint32_t contexto;        //!< Puntero de pila con el contexto guardado, debe ser el primero
+    struct nodo_s nodo;       //!< Enlace en la lista de tareas listas o en la de espera
+    lista_t espera;           //!< Lista de espera de la tarea bloqueada, NULL por notificación
+    estado_t estado;          //!< Estado actual de la tarea
+    uint8_t prioridad;        //!< Prioridad de la tarea, mayor valor indica mayor prioridad
+    uint8_t particion;        //!< Partición temporal a la que pertenece la tarea
+    volatile bool notificada; //!< Bandera de notificación pendiente para la tarea
+    int id;                   //!< Numero de la tarea
+    uint8_t * pila;           //!< Inicio de la pila de la tarea, para medir su uso
+    uint32_t despertar;       //!< Tick en el que termina la demora de la tarea
+    uint64_t ciclos;          //!< Ciclos de procesador ejecutados por la tarea
+};
+
+//! Estructura para almacenar el estado de una partición temporal
+typedef struct particion_s {
+    uint32_t presupuesto;        //!< Ticks de procesador por marco principal, cero sin límite
+    uint32_t consumido;          //!< Ticks de procesador usados en el marco actual
+    particion_agotada_t agotada; //!< Función que se llama al agotarse el presupuesto
+    bool suspendida;             //!< La partición agotó su presupuesto en el marco actual
+} * particion_t;
+
+//! Estructura para almacenar el descriptor de un semaforo
+struct semaforo_s {
+    uint32_t cuenta;          //!< Cantidad de veces que se puede tomar el semaforo sin bloquear
+    struct lista_s esperando; //!< Tareas bloqueadas en el semaforo, ordenadas por prioridad
+    bool allocated;           //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Estructura para almacenar el descriptor de una cola de punteros
+struct cola_s {
+    void * elementos[QUEUE_LENGTH]; //!< Punteros almacenados en la cola
+    uint8_t longitud;               //!< Cantidad máxima de elementos de la cola
+    uint8_t primero;                //!< Posición del elemento más antiguo
+    uint8_t cantidad;               //!< Cantidad de elementos en la cola
+    semaforo_t espacios;            //!< Semaforo con la cantidad de lugares libres
+    semaforo_t ocupados;            //!< Semaforo con la cantidad de elementos
+    bool allocated;                 //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Estructura para almacenar el descriptor de un temporizador
+struct temporizador_s {
+    struct nodo_s nodo;             //!< Enlace en la lista de activos, la clave es el vencimiento
+    temporizador_funcion_t funcion; //!< Función que se ejecuta al vencer
+    void * datos;                   //!< Puntero que se entrega a la función
+    bool allocated;                 //!< Bandera para indicar que el descriptor esta en uso
+};
+
+/* === Private variable declarations =========================================================== */
+
+/** Espacio para la pila de las tareas */
+static stack_t stack[TASK_COUNT] __attribute__((aligned(8)));
+
+/** Descriptores de las tareas del sistema */
+static struct tarea_s tareas[TASK_COUNT];
+
+/** Descriptor con el contexto del sistema operativo, que se ejecuta cuando no hay tareas listas */
+static struct tarea_s sistema = {.id = TASK_COUNT};
+
+/** Tarea en ejecución, o el descriptor del sistema operativo si no hay ninguna */
+static struct tarea_s * activa = &sistema;
+
+/** Tareas listas para ejecutar, ordenadas por prioridad y en orden de llegada */
+static struct lista_s listas = LISTA_VACIA(listas);
+
+/** Ultima tarea lista de cada nivel de prioridad, NULL si el nivel está vacío */
+static nodo_t ultimas[PRIORITY_LEVELS] = {0};
+
+/** Mapa de los niveles de prioridad con tareas listas, un bit por nivel */
+static uint32_t ocupados = 0;
+
+/** Tareas demoradas, ordenadas por tick de despertar */
+static struct lista_s dormidas = LISTA_VACIA(dormidas);
+
+/** Valor del contador de ciclos en el último cambio de contexto */
+static uint32_t ultimo_cambio = 0;
+
+/** Cantidad de interrupciones anidadas que entraron con InterrupcionEntrar */
+static volatile uint8_t anidamiento = 0;
+
+/** Cambio de contexto solicitado dentro de una interrupción, postergado hasta la última salida */
+static volatile bool cambio_pendiente = false;
+
+/** Estado de las particiones temporales */
+static struct particion_s particiones[PARTITION_COUNT] = {0};
+
+/** Duración del marco principal en ticks, cero si las particiones no están configuradas */
+static uint32_t marco = 0;
+
+/** Ticks transcurridos desde el comienzo del marco principal actual */
+static uint32_t posicion_marco = 0;
+
+/** Cantidad de ticks transcurridos desde el arranque */
+static volatile uint32_t tiempo = 0;
+
+/** Descriptores de los temporizadores del sistema */
+static struct temporizador_s temporizadores[TIMER_INSTANCES] = {0};
+
+/** Temporizadores en marcha, ordenados por tick de vencimiento */
+static struct lista_s activos = LISTA_VACIA(activos);
+
+/** Primer descriptor de las tareas declaradas, generado por el enlazador para la sección */
+extern const struct tarea_declarada_s __start_tareas[] __attribute__((weak));
+
+/** Fin de los descriptores de las tareas declaradas, generado por el enlazador */
+extern const struct tarea_declarada_s __stop_tareas[] __attribute__((weak));
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Función que prepara una lista vacía
+ *
+ * @param   lista       Lista a preparar
+ */
+static void ListaIniciar(lista_t lista);
+
+/**
+ * @brief Función que agrega un nodo a una lista ordenada por clave
+ *
+ * El nodo se ubica después de todos los que tienen una clave menor o igual, de manera que los
+ * nodos con la misma clave se mantienen en orden de llegada. Las claves se comparan por su
+ * diferencia, por lo que los ticks de vencimiento pueden desbordar.
+ *
+ * @param   lista       Lista en la que se agrega el nodo
+ * @param   nodo        Nodo a agregar, que no debe estar en ninguna lista
+ */
+static void ListaInsertar(lista_t lista, nodo_t nodo);
+
+/**
+ * @brief Función que quita un nodo de la lista en la que está, en tiempo constante
+ *
+ * @param   nodo        Nodo a quitar, puede no estar en ninguna lista
+ */
+static void ListaQuitar(nodo_t nodo);
+
+/**
+ * @brief Función que agrega una tarea a la lista de tareas listas, en tiempo constante
+ *
+ * La tarea se ubica a continuación de la última de su nivel de prioridad o, si no hay ninguna,
+ * de la última del nivel ocupado inmediatamente superior, que se busca en el mapa de niveles
+ * ocupados con una sola instrucción.
+ *
+ * @param   tarea       Descriptor de la tarea, que no debe estar en ninguna lista
+ */
+static void ListosInsertar(struct tarea_s * tarea);
+
+/**
+ * @brief Función que quita una tarea de la lista de tareas listas, en tiempo constante
+ *
+ * @param   tarea       Descriptor de la tarea, que debe estar en la lista de tareas listas
+ */
+static void ListosQuitar(struct tarea_s * tarea);
+
+/**
+ * @brief Función que devuelve el primer nodo de una lista
+ *
+ * @param   lista       Lista a consultar
+ * @return  nodo_t      Primer nodo de la lista, o NULL si está vacía
+ */
+static nodo_t ListaPrimero(lista_t lista);
+
+/**
+ * @brief Función que solicita un cambio de contexto
+ *
+ * Dentro de una interrupción que entró con InterrupcionEntrar solo se registra el pedido, que
+ * se realiza una única vez al salir de la interrupción más externa.
+ *
+ * @remark Debe llamarse con las interrupciones deshabilitadas
+ */
+static void SolicitarCambio(void);
+
+/**
+ * @brief Función que busca en una lista ordenada el primer vencimiento dentro de una ventana
+ *
+ * @param   lista       Lista ordenada por tick de vencimiento
+ * @param   inicio      Primer tick de la ventana
+ * @param   fin         Último tick de la ventana
+ * @param   encontrado  Vencimiento encontrado, solo se modifica si se encuentra uno
+ * @return  true        Hay un vencimiento dentro de la ventana
+ * @return  false       No hay vencimientos dentro de la ventana
+ */
+static bool BuscarVencimiento(lista_t lista, uint32_t inicio, uint32_t fin, uint32_t * encontrado);
+
+/**
+ * @brief Función que calcula el tick de vencimiento de un temporizador o una demora
+ *
+ * Dentro de la ventana que permite la holgura se elige el primer vencimiento ya programado de
+ * un temporizador o de una demora. Si no hay ninguno se elige el tick de la ventana que es
+ * múltiplo de la mayor potencia de dos, para que las actividades independientes tiendan a
+ * coincidir en los mismos ticks.
+ *
+ * @remark Debe llamarse con las interrupciones deshabilitadas
+ *
+ * @param   ticks       Cantidad mínima de ticks hasta el vencimiento, cero equivale a uno
+ * @param   holgura     Cantidad máxima de ticks adicionales
+ * @return  uint32_t    Tick de vencimiento elegido
+ */
+static uint32_t Vencimiento(uint32_t ticks, uint32_t holgura);
+
+/**
+ * @brief Función que mide la máxima cantidad de bytes usados de una pila
+ *
+ * Cuenta los bytes desde el inicio de la pila que conservan el valor con el que se llenó al
+ * crear la tarea.
+ *
+ * @param   pila        Inicio de la pila de la tarea
+ * @return  uint16_t    Cantidad de bytes usados de la pila
+ */
+static uint16_t UsoPila(const uint8_t * pila);
+
+/**
+ * @brief Función que pone en estado lista a una tarea y la agrega a la lista de tareas listas
+ *
+ * @param   tarea       Descriptor de la tarea
+ */
+static void ActivarTarea(struct tarea_s * tarea);
+
+/**
+ * @brief Función que prepara la pila de una tarea y la pone en estado lista
+ *
+ * Llena la pila con STACK_PATTERN para medir su uso y copia el contexto inicial a su extremo
+ * superior, completando el puntero r7 que depende de la ubicación de la pila.
+ *
+ * @param   id          Numero de la tarea, entre 0 y TASK_COUNT - 1
+ * @param   inicial     Contexto inicial de la tarea
+ */
+static void PrepararTarea(int id, const struct tarea_contexto_s * inicial);
+
+/**
+ * @brief Función que pone en estado lista a las tareas declaradas con TAREA_DECLARAR
+ *
+ * Copia el contexto inicial de cada tarea, ya armado al compilar, a su pila.
+ */
+static void IniciarTareasDeclaradas(void);
+
+/**
+ * @brief Función que descuenta un tick del presupuesto de la partición de la tarea activa
+ *
+ * También renueva el presupuesto de todas las particiones al comienzo de cada marco principal.
+ */
+static void DescontarPresupuesto(void);
+
+/**
+ * @brief Función que selecciona la próxima tarea a ejecutar
+ *
+ * Envía a la tarea que estaba en ejecución detrás de las demás tareas listas de igual prioridad
+ * y toma la primera de la lista cuya partición no agotó su presupuesto, de manera que las tareas
+ * de la misma prioridad se alternan.
+ *
+ * @return  struct tarea_s *    Tarea seleccionada, o el descriptor del sistema si no hay tareas
+ */
+static struct tarea_s * SiguienteTarea(void);
+
+/**
+ * @brief Función que bloquea a la tarea activa esperando por un objeto del núcleo
+ *
+ * @remark Debe llamarse con las interrupciones deshabilitadas, el cambio de contexto se produce
+ *         al habilitarlas nuevamente
+ *
+ * @param   espera      Lista de espera del objeto, o NULL para esperar una notificación
+ */
+static void BloquearTarea(lista_t espera);
+
+/**
+ * @brief Función que desbloquea a una tarea y la devuelve a la lista de tareas listas
+ *
+ * @remark Debe llamarse con las interrupciones deshabilitadas
+ *
+ * @param   tarea       Descriptor de la tarea bloqueada
+ */
+static void DesbloquearTarea(struct tarea_s * tarea);
+
+/**
+ * @brief Función que desbloquea a la tarea de mayor prioridad que espera en una lista
+ *
+ * @remark Debe llamarse con las interrupciones deshabilitadas
+ *
+ * @param   espera      Lista de espera del objeto
+ */
+static void DespertarPrimera(lista_t espera);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void ListaIniciar(lista_t lista) {
+    lista->cabecera.siguiente = &lista->cabecera;
+    lista->cabecera.anterior = &lista->cabecera;
+}
+
+static void ListaInsertar(lista_t lista, nodo_t nodo) {
+    nodo_t posicion = lista->cabecera.siguiente;
+
+    while ((posicion != &lista->cabecera) && ((int32_t)(posicion->clave - nodo->clave) <= 0)) {
+        posicion = posicion->siguiente;
+    }
+    nodo->siguiente = posicion;
+    nodo->anterior = posicion->anterior;
+    posicion->anterior->siguiente = nodo;
+    posicion->anterior = nodo;
+}
+
+static void ListaQuitar(nodo_t nodo) {
+    if (nodo->siguiente) {
+        nodo->siguiente->anterior = nodo->anterior;
+        nodo->anterior->siguiente = nodo->siguiente;
+        nodo->siguiente = NULL;
+        nodo->anterior = NULL;
+    }
+}
+
+static void ListosInsertar(struct tarea_s * tarea) {
+    uint32_t superiores = ocupados & ~((1UL << tarea->prioridad) - 1);
+    nodo_t anterior = &listas.cabecera;
+    nodo_t nodo = &tarea->nodo;
+
+    if (superiores) {
+        /* El nivel ocupado más bajo entre los de igual o mayor prioridad */
+        anterior = ultimas[__CLZ(__RBIT(superiores))];
+    }
+    nodo->clave = UINT8_MAX - tarea->prioridad;
+    nodo->anterior = anterior;
+    nodo->siguiente = anterior->siguiente;
+    anterior->siguiente->anterior = nodo;
+    anterior->siguiente = nodo;
+    ultimas[tarea->prioridad] = nodo;
+    ocupados |= 1UL << tarea->prioridad;
+}
+
+static void ListosQuitar(struct tarea_s * tarea) {
+    nodo_t nodo = &tarea->nodo;
+    uint8_t nivel = tarea->prioridad;
+
+    if (ultimas[nivel] == nodo) {
+        if ((nodo->anterior != &listas.cabecera) &&
+            (CONTENEDOR(nodo->anterior, struct tarea_s, nodo)->prioridad == nivel)) {
+            ultimas[nivel] = nodo->anterior;
+        } else {
+            ultimas[nivel] = NULL;
+            ocupados &= ~(1UL << nivel);
+        }
+    }
+    ListaQuitar(nodo);
+}
+
+static nodo_t ListaPrimero(lista_t lista) {
+    if (lista->cabecera.siguiente == &lista->cabecera) {
+        return NULL;
+    }
+    return lista->cabecera.siguiente;
+}
+
+static void SolicitarCambio(void) {
+    if (anidamiento) {
+        cambio_pendiente = true;
+    } else {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+}
+
+static bool BuscarVencimiento(lista_t lista, uint32_t inicio, uint32_t fin, uint32_t * encontrado) {
+    for (nodo_t nodo = ListaPrimero(lista); nodo != NULL; nodo = nodo->siguiente) {
+        if ((nodo == &lista->cabecera) || ((int32_t)(nodo->clave - fin) > 0)) {
+            break;
+        }
+        if ((int32_t)(nodo->clave - inicio) >= 0) {
+            *encontrado = nodo->clave;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t Vencimiento(uint32_t ticks, uint32_t holgura) {
+    uint32_t inicio = tiempo + (ticks ? ticks : 1);
+    uint32_t fin = inicio + holgura;
+    uint32_t temporizador = fin;
+    uint32_t demora = fin;
+    uint32_t redondo;
+    bool encontrado;
+
+    if (holgura == 0) {
+        return inicio;
+    }
+
+    encontrado = BuscarVencimiento(&activos, inicio, fin, &temporizador);
+    encontrado = BuscarVencimiento(&dormidas, inicio, fin, &demora) || encontrado;
+    if (encontrado) {
+        return ((int32_t)(temporizador - demora) < 0) ? temporizador : demora;
+    }
+
+    for (int bits = 31; bits > 0; bits--) {
+        redondo = fin & (0xFFFFFFFF << bits);
+        if ((int32_t)(redondo - inicio) >= 0) {
+            return redondo;
+        }
+    }
+    return fin;
+}
+
+static uint16_t UsoPila(const uint8_t * pila) {
+    uint16_t libre = 0;
+
+    while ((libre < STACK_SIZE) && (pila[libre] == STACK_PATTERN)) {
+        libre++;
+    }
+    return STACK_SIZE - libre;
+}
+
+static void ActivarTarea(struct tarea_s * tarea) {
+    tarea->id = tarea - tareas;
+    if (tarea->estado == TAREA_LISTA) {
+        ListosQuitar(tarea);
+    } else {
+        ListaQuitar(&tarea->nodo);
+    }
+    tarea->estado = TAREA_LISTA;
+    ListosInsertar(tarea);
+}
+
+static void PrepararTarea(int id, const struct tarea_contexto_s * inicial) {
+    void * stack_pointer = stack[id] + STACK_SIZE;
+    context_t context_pointer = stack_pointer - sizeof(struct tarea_contexto_s);
+
+    memset(stack[id], STACK_PATTERN, STACK_SIZE - sizeof(struct tarea_contexto_s));
+    *context_pointer = *inicial;
+    context_pointer->aditional.r7 = (uint32_t)(stack_pointer);
+    tareas[id].contexto = (uint32_t)(context_pointer);
+    tareas[id].pila = stack[id];
+    ActivarTarea(&tareas[id]);
+}
+
+static void IniciarTareasDeclaradas(void) {
+    for (const struct tarea_declarada_s * tarea = __start_tareas; tarea < __stop_tareas; tarea++) {
+        if ((tarea->numero < 0) || (tarea->numero >= TASK_COUNT)) {
+            Error();
+        }
+        PrepararTarea(tarea->numero, &tarea->contexto);
+    }
+}
+
+static void DescontarPresupuesto(void) {
+    particion_t particion;
+
+    if (marco == 0) {
+        return;
+    }
+
+    if (activa != &sistema) {
+        particion = &particiones[activa->particion];
+        if (particion->presupuesto) {
+            particion->consumido++;
+            if ((particion->consumido >= particion->presupuesto) && (!particion->suspendida)) {
+                particion->suspendida = true;
+                if (particion->agotada) {
+                    particion->agotada(activa->particion);
+                }
+            }
+        }
+    }
+
+    posicion_marco++;
+    if (posicion_marco >= marco) {
+        posicion_marco = 0;
+        for (int indice = 0; indice < PARTITION_COUNT; indice++) {
+            particiones[indice].consumido = 0;
+            particiones[indice].suspendida = false;
+        }
+    }
+}
+
+static struct tarea_s * SiguienteTarea(void) {
+    static bool iniciado = false;
+    uint32_t estado = __get_PRIMASK();
+    struct tarea_s * siguiente;
+    nodo_t primera;
+
+    __disable_irq();
+    if (!iniciado) {
+        iniciado = true;
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        IniciarTareasDeclaradas();
+    }
+    activa->ciclos += DWT->CYCCNT - ultimo_cambio;
+    ultimo_cambio = DWT->CYCCNT;
+
+    /* La tarea que deja el procesador pasa al final de su nivel, sin recorrer la lista */
+    if ((activa != &sistema) && (activa->estado == TAREA_LISTA)) {
+        ListosQuitar(activa);
+        ListosInsertar(activa);
+    }
+    siguiente = &sistema;
+    for (primera = ListaPrimero(&listas); primera != NULL; primera = primera->siguiente) {
+        if (primera == &listas.cabecera) {
+            break;
+        }
+        if (!particiones[CONTENEDOR(primera, struct tarea_s, nodo)->particion].suspendida) {
+            siguiente = CONTENEDOR(primera, struct tarea_s, nodo);
+            break;
+        }
+    }
+    __set_PRIMASK(estado);
+
+    if (siguiente != activa) {
+        GANCHO_SALIDA(activa->id);
+        GANCHO_ENTRADA(siguiente->id);
+    }
+    return siguiente;
+}
+
+static void BloquearTarea(lista_t espera) {
+    ListosQuitar(activa);
+    activa->estado = TAREA_BLOQUEADA;
+    activa->espera = espera;
+    if (espera) {
+        ListaInsertar(espera, &activa->nodo);
+    }
+    SolicitarCambio();
+}
+
+static void DesbloquearTarea(struct tarea_s * tarea) {
+    if (tarea->estado == TAREA_BLOQUEADA) {
+        ListaQuitar(&tarea->nodo);
+        tarea->espera = NULL;
+        tarea->estado = TAREA_LISTA;
+        ListosInsertar(tarea);
+        SolicitarCambio();
+    }
+}
+
+static void DespertarPrimera(lista_t espera) {
+    nodo_t primera = ListaPrimero(espera);
+
+    if (primera) {
+        DesbloquearTarea(CONTENEDOR(primera, struct tarea_s, nodo));
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+__attribute__((naked(), optimize("O0"))) void PendSV_Handler(void) {
+    __asm__("push {r4-r11, lr}");
+    __asm__("str r13, %0" : "=m"(activa->contexto));
+    __asm__("ldr r13, %0" : : "m"(sistema.contexto));
+
+    activa = SiguienteTarea();
+
+    __asm__("str r13, %0" : "=m"(sistema.contexto));
+    __asm__("ldr r13, %0" : : "m"(activa->contexto));
+    __asm__("pop {r4-r11, lr}");
+    __asm__("bx lr");
+}
+
+void CrearTarea(int id, void * entry_point) {
+    CrearTareaConArgumento(id, (tarea_funcion_t)entry_point, NULL);
+}
+
+void CrearTareaConArgumento(int id, tarea_funcion_t entry_point, void * argumento) {
+    struct tarea_contexto_s inicial = {
+        .aditional = {.lr = 0xfffffff9},
+        .interrupt = {.r0 = (uint32_t)argumento, .lr = (uint32_t)Error,
+                      .pc = (uint32_t)entry_point, .xPSR = 0x01000000},
+    };
+
+    PrepararTarea(id, &inicial);
+}
+
+void TickSistema(void) {
+    temporizador_t temporizador;
+    uint32_t estado;
+    nodo_t primero;
+
+    GANCHO_TICK();
+    tiempo++;
+    DescontarPresupuesto();
+    while (1) {
+        estado = __get_PRIMASK();
+        __disable_irq();
+        primero = ListaPrimero(&activos);
+        if ((primero == NULL) || ((int32_t)(tiempo - primero->clave) < 0)) {
+            __set_PRIMASK(estado);
+            break;
+        }
+        ListaQuitar(primero);
+        __set_PRIMASK(estado);
+
+        temporizador = CONTENEDOR(primero, struct temporizador_s, nodo);
+        temporizador->funcion(temporizador->datos);
+    }
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    primero = ListaPrimero(&dormidas);
+    while ((primero != NULL) && ((int32_t)(tiempo - primero->clave) >= 0)) {
+        DesbloquearTarea(CONTENEDOR(primero, struct tarea_s, nodo));
+        primero = ListaPrimero(&dormidas);
+    }
+    __set_PRIMASK(estado);
+    SolicitarCambio();
+}
+
+void InterrupcionEntrar(void) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    anidamiento++;
+    __set_PRIMASK(estado);
+}
+
+void InterrupcionSalir(void) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    anidamiento--;
+    if ((anidamiento == 0) && (cambio_pendiente)) {
+        cambio_pendiente = false;
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+    __set_PRIMASK(estado);
+}
+
+bool InterrupcionActiva(void) {
+    return (__get_IPSR() != 0);
+}
+
+int TareaActual(void) {
+    return activa->id;
+}
+
+void ParticionesConfigurarMarco(uint32_t ticks) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    marco = ticks;
+    posicion_marco = 0;
+    for (int indice = 0; indice < PARTITION_COUNT; indice++) {
+        particiones[indice].consumido = 0;
+        particiones[indice].suspendida = false;
+    }
+    __set_PRIMASK(estado);
+}
+
+void ParticionConfigurar(uint8_t particion, uint32_t presupuesto, particion_agotada_t agotada) {
+    uint32_t estado = __get_PRIMASK();
+
+    if (particion >= PARTITION_COUNT) {
+        return;
+    }
+
+    __disable_irq();
+    particiones[particion].presupuesto = presupuesto;
+    particiones[particion].agotada = agotada;
+    particiones[particion].suspendida = false;
+    __set_PRIMASK(estado);
+}
+
+void TareaAsignarParticion(int id, uint8_t particion) {
+    if (particion < PARTITION_COUNT) {
+        tareas[id].particion = particion;
+    }
+}
+
+void TareaAsignarPrioridad(int id, uint8_t prioridad) {
+    struct tarea_s * tarea = &tareas[id];
+    uint32_t estado = __get_PRIMASK();
+
+    if (prioridad >= PRIORITY_LEVELS) {
+        prioridad = PRIORITY_LEVELS - 1;
+    }
+
+    __disable_irq();
+    if (tarea->estado == TAREA_LISTA) {
+        ListosQuitar(tarea);
+        tarea->prioridad = prioridad;
+        ListosInsertar(tarea);
+        SolicitarCambio();
+    } else {
+        tarea->prioridad = prioridad;
+        if ((tarea->nodo.siguiente) && (tarea->espera != &dormidas)) {
+            tarea->nodo.clave = UINT8_MAX - prioridad;
+            ListaQuitar(&tarea->nodo);
+            ListaInsertar(tarea->espera, &tarea->nodo);
+            SolicitarCambio();
+        }
+    }
+    __set_PRIMASK(estado);
+}
+
+uint32_t TiempoSistema(void) {
+    return tiempo;
+}
+
+void TareaDemorar(uint32_t ticks) {
+    TareaDemorarConHolgura(ticks, 0);
+}
+
+void TareaDemorarConHolgura(uint32_t ticks, uint32_t holgura) {
+    __disable_irq();
+    activa->despertar = Vencimiento(ticks, holgura);
+    while ((int32_t)(tiempo - activa->despertar) < 0) {
+        activa->nodo.clave = activa->despertar;
+        BloquearTarea(&dormidas);
+        __enable_irq();
+        __ISB();
+        __disable_irq();
+    }
+    __enable_irq();
+}
+
+int EstadoSistema(tarea_informe_t * informes, int cantidad) {
+    struct tarea_s * tarea;
+    tarea_informe_t * informe;
+    uint32_t estado;
+    uint32_t ahora;
+
+    if (cantidad > TASK_COUNT + 1) {
+        cantidad = TASK_COUNT + 1;
+    }
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    ahora = DWT->CYCCNT;
+    for (int indice = 0; indice < cantidad; indice++) {
+        tarea = (indice < TASK_COUNT) ? &tareas[indice] : &sistema;
+        informe = &informes[indice];
+        informe->id = indice;
+        informe->prioridad = tarea->prioridad;
+        informe->particion = tarea->particion;
+        informe->ciclos = tarea->ciclos + ((tarea == activa) ? ahora - ultimo_cambio : 0);
+        informe->objeto = NULL;
+        informe->despertar = 0;
+        informe->pila = 0;
+        if (tarea == activa) {
+            informe->estado = TAREA_ESTADO_EJECUCION;
+        } else if (tarea->estado == TAREA_LISTA) {
+            informe->estado = TAREA_ESTADO_LISTA;
+        } else if (tarea->estado == TAREA_BLOQUEADA) {
+            informe->estado = TAREA_ESTADO_BLOQUEADA;
+            if (tarea->espera == &dormidas) {
+                informe->despertar = tarea->despertar;
+            } else if (tarea->espera != NULL) {
+                informe->objeto = CONTENEDOR(tarea->espera, struct semaforo_s, esperando);
+            }
+        } else {
+            informe->estado = (tarea == &sistema) ? TAREA_ESTADO_LISTA : TAREA_ESTADO_SUSPENDIDA;
+        }
+    }
+    __set_PRIMASK(estado);
+
+    for (int indice = 0; indice < cantidad; indice++) {
+        if ((indice < TASK_COUNT) && (tareas[indice].pila != NULL)) {
+            informes[indice].pila = UsoPila(tareas[indice].pila);
+        }
+    }
+    return cantidad;
+}
+
+void TareaEsperarNotificacion(void) {
+    __disable_irq();
+    while (!activa->notificada) {
+        BloquearTarea(NULL);
+        __enable_irq();
+        __ISB();
+        __disable_irq();
+    }
+    activa->notificada = false;
+    __enable_irq();
+}
+
+void TareaNotificar(int id) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    tareas[id].notificada = true;
+    if (tareas[id].espera == NULL) {
+        DesbloquearTarea(&tareas[id]);
+    }
+    __set_PRIMASK(estado);
+}
+
+semaforo_t SemaforoCrear(uint32_t inicial) {
+    semaforo_t semaforo = NULL;
+
+    static struct semaforo_s instances[SEMAPHORE_INSTANCES] = {0};
+
+    for (int index = 0; index < SEMAPHORE_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            semaforo = &instances[index];
+            break;
+        }
+    }
+
+    if (semaforo) {
+        semaforo->cuenta = inicial;
+        ListaIniciar(&semaforo->esperando);
+    }
+    return semaforo;
+}
+
+void SemaforoDestruir(semaforo_t semaforo) {
+    if (semaforo) {
+        semaforo->allocated = false;
+    }
+}
+
+void SemaforoTomar(semaforo_t semaforo) {
+    __disable_irq();
+    while (semaforo->cuenta == 0) {
+        BloquearTarea(&semaforo->esperando);
+        __enable_irq();
+        __ISB();
+        __disable_irq();
+    }
+    semaforo->cuenta--;
+    __enable_irq();
+}
+
+void SemaforoLiberar(semaforo_t semaforo) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    semaforo->cuenta++;
+    DespertarPrimera(&semaforo->esperando);
+    __set_PRIMASK(estado);
+}
+
+bool SemaforoIntentarTomar(semaforo_t semaforo) {
+    uint32_t estado = __get_PRIMASK();
+    bool resultado = false;
+
+    __disable_irq();
+    if (semaforo->cuenta) {
+        semaforo->cuenta--;
+        resultado = true;
+    }
+    __set_PRIMASK(estado);
+    return resultado;
+}
+
+cola_t ColaCrear(uint8_t longitud) {
+    cola_t cola = NULL;
+
+    static struct cola_s instances[QUEUE_INSTANCES] = {0};
+
+    if ((longitud == 0) || (longitud > QUEUE_LENGTH)) {
+        return NULL;
+    }
+
+    for (int index = 0; index < QUEUE_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            cola = &instances[index];
+            break;
+        }
+    }
+
+    if (cola) {
+        cola->longitud = longitud;
+        cola->primero = 0;
+        cola->cantidad = 0;
+        cola->espacios = SemaforoCrear(longitud);
+        cola->ocupados = SemaforoCrear(0);
+        if (!cola->espacios || !cola->ocupados) {
+            ColaDestruir(cola);
+            cola = NULL;
+        }
+    }
+    return cola;
+}
+
+void ColaDestruir(cola_t cola) {
+    if (cola) {
+        SemaforoDestruir(cola->espacios);
+        SemaforoDestruir(cola->ocupados);
+        cola->espacios = NULL;
+        cola->ocupados = NULL;
+        cola->allocated = false;
+    }
+}
+
+void ColaEnviar(cola_t cola, void * elemento) {
+    uint32_t estado;
+
+    SemaforoTomar(cola->espacios);
+    estado = __get_PRIMASK();
+    __disable_irq();
+    cola->elementos[(cola->primero + cola->cantidad) % cola->longitud] = elemento;
+    cola->cantidad++;
+    SemaforoLiberar(cola->ocupados);
+    __set_PRIMASK(estado);
+}
+
+bool ColaIntentarEnviar(cola_t cola, void * elemento) {
+    uint32_t estado;
+
+    if (!SemaforoIntentarTomar(cola->espacios)) {
+        return false;
+    }
+    estado = __get_PRIMASK();
+    __disable_irq();
+    cola->elementos[(cola->primero + cola->cantidad) % cola->longitud] = elemento;
+    cola->cantidad++;
+    SemaforoLiberar(cola->ocupados);
+    __set_PRIMASK(estado);
+    return true;
+}
+
+void * ColaRecibir(cola_t cola) {
+    void * elemento;
+    uint32_t estado;
+
+    SemaforoTomar(cola->ocupados);
+    estado = __get_PRIMASK();
+    __disable_irq();
+    elemento = cola->elementos[cola->primero];
+    cola->primero = (cola->primero + 1) % cola->longitud;
+    cola->cantidad--;
+    SemaforoLiberar(cola->espacios);
+    __set_PRIMASK(estado);
+    return elemento;
+}
+
+void * ColaIntentarRecibir(cola_t cola) {
+    void * elemento;
+    uint32_t estado;
+
+    if (!SemaforoIntentarTomar(cola->ocupados)) {
+        return NULL;
+    }
+    estado = __get_PRIMASK();
+    __disable_irq();
+    elemento = cola->elementos[cola->primero];
+    cola->primero = (cola->primero + 1) % cola->longitud;
+    cola->cantidad--;
+    SemaforoLiberar(cola->espacios);
+    __set_PRIMASK(estado);
+    return elemento;
+}
+
+uint8_t ColaCantidad(cola_t cola) {
+    return cola->cantidad;
+}
+
+temporizador_t TemporizadorCrear(temporizador_funcion_t funcion, void * datos) {
+    temporizador_t temporizador = NULL;
+
+    for (int index = 0; index < TIMER_INSTANCES; index++) {
+        if (!temporizadores[index].allocated) {
+            temporizadores[index].allocated = true;
+            temporizador = &temporizadores[index];
+            break;
+        }
+    }
+
+    if (temporizador) {
+        temporizador->funcion = funcion;
+        temporizador->datos = datos;
+    }
+    return temporizador;
+}
+
+void TemporizadorDestruir(temporizador_t temporizador) {
+    if (temporizador) {
+        TemporizadorDetener(temporizador);
+        temporizador->allocated = false;
+    }
+}
+
+void TemporizadorIniciar(temporizador_t temporizador, uint32_t ticks) {
+    TemporizadorIniciarConHolgura(temporizador, ticks, 0);
+}
+
+void TemporizadorIniciarConHolgura(temporizador_t temporizador, uint32_t ticks, uint32_t holgura) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    ListaQuitar(&temporizador->nodo);
+    /* Un tiempo nulo vencería en el pasado, se espera al menos hasta el próximo tick */
+    temporizador->nodo.clave = Vencimiento(ticks, holgura);
+    ListaInsertar(&activos, &temporizador->nodo);
+    __set_PRIMASK(estado);
+}
+
+void TemporizadorDetener(temporizador_t temporizador) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    ListaQuitar(&temporizador->nodo);
+    __set_PRIMASK(estado);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
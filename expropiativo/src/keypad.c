@@ -0,0 +1,251 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Matrix keypad definitions
+ **
+ ** Mientras no hay teclas presionadas todas las columnas están activas y cualquier tecla lleva su
+ ** fila a nivel bajo, lo que dispara la interrupción de grupo GINT0. Esa interrupción se
+ ** deshabilita y arranca un temporizador del núcleo que barre el teclado columna por columna,
+ ** filtra los rebotes de cada tecla y encola los eventos. Cuando todas las teclas quedan sueltas
+ ** y estables el barrido se detiene y se vuelve a habilitar la interrupción.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "keypad.h"
+#include "chip.h"
+#include "digital.h"
+#include "kernel.h"
+
+/* === Macros definitions ====================================================================== */
+
+//! Grupo de terminales usado para detectar la primer tecla presionada
+#define KEYPAD_GROUP 0
+
+//! Cantidad máxima de teclas
+#define KEYPAD_MAX_KEYS (KEYPAD_MAX_ROWS * KEYPAD_MAX_COLUMNS)
+
+//! Ciclos que se esperan después de cambiar una columna para que las filas se estabilicen
+#define KEYPAD_SETTLE_CYCLES 16
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor del teclado
+struct keypad_s {
+    digital_input_t rows[KEYPAD_MAX_ROWS];        //!< Filas del teclado
+    digital_output_t columns[KEYPAD_MAX_COLUMNS]; //!< Columnas del teclado
+    uint8_t row_count;                            //!< Cantidad de filas
+    uint8_t column_count;                         //!< Cantidad de columnas
+    bool pressed[KEYPAD_MAX_KEYS];                //!< Estado filtrado de cada tecla
+    uint8_t counters[KEYPAD_MAX_KEYS];            //!< Barridos con un estado distinto
+    keypad_event_t queue[KEYPAD_QUEUE_LENGTH];    //!< Eventos pendientes de lectura
+    uint8_t head;                                 //!< Posición del evento más antiguo
+    uint8_t count;                                //!< Cantidad de eventos en la cola
+    uint32_t overruns;                            //!< Cantidad de eventos descartados
+    semaforo_t events;                            //!< Semaforo con la cantidad de eventos
+    temporizador_t timer;                         //!< Temporizador del barrido
+    bool allocated;                               //!< Bandera para indicar que ya fue creado
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Descriptor del único teclado, atado a la interrupción de grupo GINT0
+static struct keypad_s instance = {0};
+
+/* === Private function declarations =========================================================== */
+
+// Función que activa una columna del teclado, o todas si column es igual a column_count
+static void KeypadSelect(keypad_t keypad, uint8_t column);
+
+// Función que encola un evento del teclado
+static void KeypadPost(keypad_t keypad, uint8_t key, bool pressed);
+
+// Función que barre el teclado y filtra los rebotes, ejecutada por el temporizador
+static void KeypadScan(void * data);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void KeypadSelect(keypad_t keypad, uint8_t column) {
+    /* Las columnas activas están en bajo para que la tecla presionada lleve su fila a cero */
+    for (int index = 0; index < keypad->column_count; index++) {
+        if ((index == column) || (column == keypad->column_count)) {
+            DigitalOutputDeactivate(keypad->columns[index]);
+        } else {
+            DigitalOutputActivate(keypad->columns[index]);
+        }
+    }
+    for (int cycle = 0; cycle < KEYPAD_SETTLE_CYCLES; cycle++) {
+        __NOP();
+    }
+}
+
+static void KeypadPost(keypad_t keypad, uint8_t key, bool pressed) {
+    if (keypad->count < KEYPAD_QUEUE_LENGTH) {
+        keypad->queue[(keypad->head + keypad->count) % KEYPAD_QUEUE_LENGTH] =
+            (keypad_event_t){.key = key, .pressed = pressed};
+        keypad->count++;
+        SemaforoLiberar(keypad->events);
+    } else {
+        keypad->overruns++;
+    }
+}
+
+static void KeypadScan(void * data) {
+    keypad_t keypad = data;
+    bool active = false;
+    bool state;
+    uint8_t key;
+
+    for (int column = 0; column < keypad->column_count; column++) {
+        KeypadSelect(keypad, column);
+        for (int row = 0; row < keypad->row_count; row++) {
+            key = row * keypad->column_count + column;
+            state = DigitalInputGetState(keypad->rows[row]);
+            if (state == keypad->pressed[key]) {
+                keypad->counters[key] = 0;
+            } else if (++keypad->counters[key] >= KEYPAD_DEBOUNCE_SCANS) {
+                keypad->counters[key] = 0;
+                keypad->pressed[key] = state;
+                KeypadPost(keypad, key, state);
+            }
+            active = active || keypad->pressed[key] || keypad->counters[key];
+        }
+    }
+    KeypadSelect(keypad, keypad->column_count);
+
+    if (active) {
+        TemporizadorIniciar(keypad->timer, MS_TO_TICKS(KEYPAD_SCAN_PERIOD));
+    } else {
+        Chip_GPIOGP_ClearIntStatus(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP);
+        NVIC_ClearPendingIRQ(GINT0_IRQn);
+        NVIC_EnableIRQ(GINT0_IRQn);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void GINT0_IRQHandler(void) {
+    NVIC_DisableIRQ(GINT0_IRQn);
+    Chip_GPIOGP_ClearIntStatus(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP);
+    TemporizadorIniciar(instance.timer, MS_TO_TICKS(KEYPAD_SCAN_PERIOD));
+}
+
+keypad_t KeypadCreate(const keypad_pin_t * rows, uint8_t row_count, const keypad_pin_t * columns,
+                      uint8_t column_count) {
+    keypad_t keypad = &instance;
+    bool valid;
+
+    if (keypad->allocated || (row_count > KEYPAD_MAX_ROWS) ||
+        (column_count > KEYPAD_MAX_COLUMNS)) {
+        return NULL;
+    }
+    keypad->row_count = row_count;
+    keypad->column_count = column_count;
+
+    /* Se toman todos los recursos antes de tocar la interrupción de grupo */
+    valid = true;
+    for (int index = 0; index < row_count; index++) {
+        keypad->rows[index] = DigitalInputCreate(rows[index].port, rows[index].pin, true);
+        valid = valid && keypad->rows[index];
+    }
+    for (int index = 0; index < column_count; index++) {
+        keypad->columns[index] = DigitalOutputCreate(columns[index].port, columns[index].pin);
+        valid = valid && keypad->columns[index];
+    }
+    keypad->events = SemaforoCrear(0);
+    keypad->timer = TemporizadorCrear(KeypadScan, keypad);
+    valid = valid && keypad->events && keypad->timer;
+
+    if (!valid) {
+        for (int index = 0; index < row_count; index++) {
+            DigitalInputDestroy(keypad->rows[index]);
+            keypad->rows[index] = NULL;
+        }
+        for (int index = 0; index < column_count; index++) {
+            DigitalOutputDestroy(keypad->columns[index]);
+            keypad->columns[index] = NULL;
+        }
+        SemaforoDestruir(keypad->events);
+        TemporizadorDestruir(keypad->timer);
+        keypad->events = NULL;
+        keypad->timer = NULL;
+        return NULL;
+    }
+    keypad->allocated = true;
+
+    for (int index = 0; index < row_count; index++) {
+        Chip_GPIOGP_SelectLowLevel(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP, rows[index].port,
+                                   1 << rows[index].pin);
+        Chip_GPIOGP_EnableGroupPins(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP, rows[index].port,
+                                    1 << rows[index].pin);
+    }
+    KeypadSelect(keypad, column_count);
+    Chip_GPIOGP_SelectOrMode(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP);
+    Chip_GPIOGP_SelectEdgeMode(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP);
+    Chip_GPIOGP_ClearIntStatus(LPC_GPIO_GROUP_INT0, KEYPAD_GROUP);
+    NVIC_ClearPendingIRQ(GINT0_IRQn);
+    NVIC_EnableIRQ(GINT0_IRQn);
+    return keypad;
+}
+
+keypad_event_t KeypadRead(keypad_t keypad) {
+    keypad_event_t event;
+    uint32_t estado;
+
+    SemaforoTomar(keypad->events);
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    event = keypad->queue[keypad->head];
+    keypad->head = (keypad->head + 1) % KEYPAD_QUEUE_LENGTH;
+    keypad->count--;
+    __set_PRIMASK(estado);
+
+    return event;
+}
+
+uint32_t KeypadOverruns(keypad_t keypad) {
+    return keypad->overruns;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,251 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Streaming data logger definitions
+ **
+ ** Los productores copian sus datos en un buffer circular de buffers del tamaño de varios bloques
+ ** de la tarjeta. Cada buffer completo se cuenta en un semaforo y la tarea de escritura lo envía a
+ ** la tarjeta por DMA directamente desde la memoria del buffer, mientras los productores siguen
+ ** llenando el siguiente. Los productores solo reservan el lugar con las interrupciones
+ ** deshabilitadas, y un buffer se entrega recién cuando se terminaron de copiar todos sus bytes.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "logger.h"
+#include "chip.h"
+#include "kernel.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Cantidad de bytes de cada buffer
+#define LOGGER_BUFFER_SIZE (LOGGER_BUFFER_BLOCKS * SD_BLOCK_SIZE)
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor del registro de datos
+struct logger_s {
+    uint8_t fill;                  //!< Buffer en el que reservan lugar los productores
+    uint8_t commit;                //!< Próximo buffer que se entrega a la tarea
+    uint8_t flush;                 //!< Buffer que escribe la tarea
+    uint8_t ready;                 //!< Cantidad de buffers reservados pendientes de escritura
+    uint16_t offset;               //!< Cantidad de bytes reservados del buffer que se llena
+    uint32_t dropped;              //!< Cantidad de bytes descartados
+    semaforo_t full;               //!< Semaforo con la cantidad de buffers completos
+    sd_card_t card;                //!< Tarjeta en la que se escribe el registro
+    uint32_t next;                 //!< Próximo bloque a escribir
+    uint32_t end;                  //!< Primer bloque fuera de la zona del registro
+    bool closed;                   //!< Se llenó la zona o falló la tarjeta
+    bool allocated;                //!< Bandera para indicar que ya fue creado
+    //! Cantidad de bytes ya copiados en cada buffer por los productores
+    uint16_t copied[LOGGER_BUFFERS];
+    //! Buffers de datos, cada uno escrito en la tarjeta con una sola operación de DMA por bloque
+    uint8_t buffers[LOGGER_BUFFERS][LOGGER_BUFFER_SIZE];
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Descriptor del único registro, atendido por la tarea LoggerTask
+static struct logger_s instance __attribute__((aligned(4))) = {0};
+
+/* === Private function declarations =========================================================== */
+
+// Función que reserva lugar en los buffers, con las interrupciones deshabilitadas
+static void LoggerReserve(logger_t logger, uint16_t length);
+
+// Función que registra una copia terminada y entrega en orden los buffers completos
+static void LoggerComplete(logger_t logger, uint8_t buffer, uint16_t length);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void LoggerReserve(logger_t logger, uint16_t length) {
+    logger->offset += length;
+    while (logger->offset >= LOGGER_BUFFER_SIZE) {
+        logger->offset -= LOGGER_BUFFER_SIZE;
+        logger->fill = (logger->fill + 1) % LOGGER_BUFFERS;
+        logger->ready++;
+    }
+}
+
+static void LoggerComplete(logger_t logger, uint8_t buffer, uint16_t length) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    logger->copied[buffer] += length;
+    /* Una copia interrumpida por otra puede terminar después, los buffers se entregan en orden */
+    while (logger->copied[logger->commit] == LOGGER_BUFFER_SIZE) {
+        logger->copied[logger->commit] = 0;
+        logger->commit = (logger->commit + 1) % LOGGER_BUFFERS;
+        SemaforoLiberar(logger->full);
+    }
+    __set_PRIMASK(estado);
+}
+
+/* === Public function implementation ========================================================= */
+
+logger_t LoggerCreate(sd_card_t card, uint32_t first, uint32_t count) {
+    logger_t logger = &instance;
+
+    if (logger->allocated) {
+        return NULL;
+    }
+    logger->full = SemaforoCrear(0);
+    if (!logger->full) {
+        return NULL;
+    }
+    logger->allocated = true;
+    logger->card = card;
+    logger->next = first;
+    logger->end = first + count;
+    logger->closed = (count < LOGGER_BUFFER_BLOCKS);
+    return logger;
+}
+
+bool LoggerWrite(logger_t logger, const void * data, uint16_t length) {
+    const uint8_t * bytes = data;
+    uint32_t available;
+    uint8_t buffer;
+    uint16_t offset;
+    uint16_t chunk;
+    uint32_t estado;
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    available = (LOGGER_BUFFERS - 1 - logger->ready) * LOGGER_BUFFER_SIZE +
+                (LOGGER_BUFFER_SIZE - logger->offset);
+    if (logger->closed || (length > available)) {
+        logger->dropped += length;
+        __set_PRIMASK(estado);
+        return false;
+    }
+
+    buffer = logger->fill;
+    offset = logger->offset;
+    LoggerReserve(logger, length);
+    __set_PRIMASK(estado);
+
+    while (length) {
+        chunk = LOGGER_BUFFER_SIZE - offset;
+        if (chunk > length) {
+            chunk = length;
+        }
+        memcpy(&logger->buffers[buffer][offset], bytes, chunk);
+        LoggerComplete(logger, buffer, chunk);
+        bytes += chunk;
+        length -= chunk;
+        buffer = (buffer + 1) % LOGGER_BUFFERS;
+        offset = 0;
+    }
+    return true;
+}
+
+void LoggerFlush(logger_t logger) {
+    uint32_t estado = __get_PRIMASK();
+    uint8_t buffer;
+    uint16_t offset;
+
+    __disable_irq();
+    buffer = logger->fill;
+    offset = logger->offset;
+    if (offset) {
+        LoggerReserve(logger, LOGGER_BUFFER_SIZE - offset);
+    }
+    __set_PRIMASK(estado);
+
+    if (offset) {
+        memset(&logger->buffers[buffer][offset], 0, LOGGER_BUFFER_SIZE - offset);
+        LoggerComplete(logger, buffer, LOGGER_BUFFER_SIZE - offset);
+    }
+}
+
+uint32_t LoggerDropped(logger_t logger) {
+    return logger->dropped;
+}
+
+void LoggerTask(void) {
+    logger_t logger = &instance;
+    bool open = false;
+    uint32_t estado;
+
+    while (1) {
+        SemaforoTomar(logger->full);
+
+        do {
+            /* La escritura múltiple mantiene la selección de la tarjeta, se abre solo con datos */
+            if (!logger->closed && !open) {
+                open = SdCardWriteStart(logger->card, logger->next);
+                logger->closed = !open;
+            }
+            if (open) {
+                if (!SdCardWriteBlocks(logger->card, logger->buffers[logger->flush],
+                                       LOGGER_BUFFER_BLOCKS)) {
+                    logger->closed = true;
+                }
+                logger->next += LOGGER_BUFFER_BLOCKS;
+                if (logger->next + LOGGER_BUFFER_BLOCKS > logger->end) {
+                    logger->closed = true;
+                }
+                if (logger->closed) {
+                    SdCardWriteStop(logger->card);
+                    open = false;
+                }
+            }
+
+            /* El buffer queda libre recién después de que el DMA terminó de leerlo */
+            estado = __get_PRIMASK();
+            __disable_irq();
+            logger->flush = (logger->flush + 1) % LOGGER_BUFFERS;
+            logger->ready--;
+            __set_PRIMASK(estado);
+        } while (SemaforoIntentarTomar(logger->full));
+
+        /* Sin más buffers completos se cierra la ráfaga y la tarjeta libera el bus */
+        if (open) {
+            logger->closed = !SdCardWriteStop(logger->card);
+            open = false;
+        }
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,207 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Producer/consumer pipeline definitions
+ **
+ ** Cada etapa tiene su cola de entrada en el kernel y los elementos se transfieren siempre por
+ ** referencia. Los contadores de una etapa describen a su cola de entrada: los bloqueos los
+ ** produce quien la alimenta y el máximo se observa cada vez que la etapa se despierta.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "pipeline.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de una cadena de procesamiento
+struct pipeline_s {
+    const pipeline_stage_t * stages;                   //!< Declaración de las etapas
+    uint8_t count;                                     //!< Cantidad de etapas
+    cola_t queues[PIPELINE_STAGES];                    //!< Cola de entrada de cada etapa
+    pipeline_statistics_t statistics[PIPELINE_STAGES]; //!< Contadores de cada etapa
+    bool allocated;                                    //!< Bandera para indicar que esta en uso
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Descriptores de las cadenas de procesamiento
+static struct pipeline_s instances[PIPELINE_INSTANCES] = {0};
+
+/* === Private function declarations =========================================================== */
+
+// Función que entrega un elemento a la cola de una etapa, contando si el productor se bloquea
+static void PipelineForward(pipeline_t pipeline, uint8_t stage, void * item);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void PipelineForward(pipeline_t pipeline, uint8_t stage, void * item) {
+    uint32_t estado;
+
+    if (!ColaIntentarEnviar(pipeline->queues[stage], item)) {
+        estado = __get_PRIMASK();
+        __disable_irq();
+        pipeline->statistics[stage].stalls++;
+        __set_PRIMASK(estado);
+        ColaEnviar(pipeline->queues[stage], item);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+pipeline_t PipelineCreate(const pipeline_stage_t * stages, uint8_t count) {
+    pipeline_t pipeline = NULL;
+
+    if ((stages == NULL) || (count == 0) || (count > PIPELINE_STAGES)) {
+        return NULL;
+    }
+
+    for (int index = 0; index < PIPELINE_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            pipeline = &instances[index];
+            break;
+        }
+    }
+
+    if (pipeline) {
+        pipeline->stages = stages;
+        pipeline->count = count;
+        for (int index = 0; index < count; index++) {
+            pipeline->queues[index] = ColaCrear(stages[index].depth);
+            if (pipeline->queues[index] == NULL) {
+                while (--index >= 0) {
+                    ColaDestruir(pipeline->queues[index]);
+                    pipeline->queues[index] = NULL;
+                }
+                pipeline->allocated = false;
+                return NULL;
+            }
+        }
+    }
+    return pipeline;
+}
+
+void PipelineSubmit(pipeline_t pipeline, void * item) {
+    PipelineForward(pipeline, 0, item);
+}
+
+bool PipelineStatistics(pipeline_t pipeline, uint8_t stage, pipeline_statistics_t * statistics) {
+    uint32_t estado;
+
+    if (stage >= pipeline->count) {
+        return false;
+    }
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    *statistics = pipeline->statistics[stage];
+    __set_PRIMASK(estado);
+    statistics->depth = ColaCantidad(pipeline->queues[stage]);
+    return true;
+}
+
+void PipelineTask(void) {
+    pipeline_t pipeline = NULL;
+    const pipeline_stage_t * declaration = NULL;
+    pipeline_statistics_t * statistics;
+    void * items[QUEUE_LENGTH];
+    uint8_t stage = 0;
+    uint8_t batch;
+    uint8_t count;
+    uint8_t depth;
+
+    for (int index = 0; (index < PIPELINE_INSTANCES) && (declaration == NULL); index++) {
+        for (stage = 0; stage < instances[index].count; stage++) {
+            if (instances[index].stages[stage].task == TareaActual()) {
+                pipeline = &instances[index];
+                declaration = &pipeline->stages[stage];
+                break;
+            }
+        }
+    }
+    if (declaration == NULL) {
+        Error();
+    }
+
+    statistics = &pipeline->statistics[stage];
+    batch = declaration->batch;
+    if ((batch == 0) || (batch > QUEUE_LENGTH)) {
+        batch = QUEUE_LENGTH;
+    }
+
+    while (1) {
+        items[0] = ColaRecibir(pipeline->queues[stage]);
+        depth = ColaCantidad(pipeline->queues[stage]) + 1;
+        for (count = 1; count < batch; count++) {
+            items[count] = ColaIntentarRecibir(pipeline->queues[stage]);
+            if (items[count] == NULL) {
+                break;
+            }
+        }
+
+        declaration->function(items, count, declaration->context);
+
+        __disable_irq();
+        statistics->items += count;
+        statistics->batches++;
+        if (depth > statistics->peak) {
+            statistics->peak = depth;
+        }
+        __enable_irq();
+
+        if (stage + 1 < pipeline->count) {
+            for (int index = 0; index < count; index++) {
+                if (items[index] != NULL) {
+                    PipelineForward(pipeline, stage + 1, items[index]);
+                }
+            }
+        }
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,216 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Zero-copy buffer pool definitions
+ **
+ ** Los buffers libres de cada pool forman una lista enlazada y su cantidad se cuenta en un
+ ** semaforo, de manera que las tareas que piden un buffer con el pool vacío quedan bloqueadas sin
+ ** consumir tiempo de procesador. Los descriptores de todos los pools salen de un único arreglo.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "pool.h"
+#include "chip.h"
+#include "kernel.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de un buffer
+struct buffer_s {
+    buffer_pool_t pool;           //!< Pool al que pertenece el buffer
+    uint8_t * data;               //!< Memoria de datos del buffer
+    uint16_t length;              //!< Cantidad de bytes válidos
+    volatile uint16_t references; //!< Cantidad de etapas que tienen el buffer
+    buffer_t next;                //!< Siguiente buffer libre del pool
+};
+
+//! Estructura para almacenar el descriptor de un pool de buffers
+struct buffer_pool_s {
+    buffer_t free;               //!< Primer buffer libre
+    semaforo_t available;        //!< Semaforo con la cantidad de buffers libres
+    uint16_t size;               //!< Cantidad de bytes de cada buffer
+    uint16_t count;              //!< Cantidad de buffers libres
+    bool allocated;              //!< Bandera para indicar que el descriptor esta en uso
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Descriptores de los pools de buffers
+static struct buffer_pool_s pools[BUFFER_POOL_INSTANCES] = {0};
+
+//! Descriptores de los buffers de todos los pools
+static struct buffer_s buffers[BUFFER_INSTANCES] = {0};
+
+//! Cantidad de descriptores de buffers ya asignados a algún pool
+static uint16_t buffers_used = 0;
+
+/* === Private function declarations =========================================================== */
+
+// Función que quita el primer buffer libre de un pool, después de haberlo descontado del semaforo
+static buffer_t BufferTake(buffer_pool_t pool);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static buffer_t BufferTake(buffer_pool_t pool) {
+    uint32_t estado = __get_PRIMASK();
+    buffer_t buffer;
+
+    __disable_irq();
+    buffer = pool->free;
+    pool->free = buffer->next;
+    pool->count--;
+    __set_PRIMASK(estado);
+
+    buffer->next = NULL;
+    buffer->length = 0;
+    buffer->references = 1;
+    return buffer;
+}
+
+/* === Public function implementation ========================================================== */
+
+buffer_pool_t BufferPoolCreate(void * memory, uint16_t size, uint16_t count) {
+    buffer_pool_t pool = NULL;
+    uint8_t * data = memory;
+
+    if ((memory == NULL) || (size == 0) || (count == 0)) {
+        return NULL;
+    }
+    if (count > BUFFER_INSTANCES - buffers_used) {
+        return NULL;
+    }
+
+    for (int index = 0; index < BUFFER_POOL_INSTANCES; index++) {
+        if (!pools[index].allocated) {
+            pools[index].allocated = true;
+            pool = &pools[index];
+            break;
+        }
+    }
+
+    if (pool) {
+        pool->available = SemaforoCrear(count);
+        if (!pool->available) {
+            pool->allocated = false;
+            return NULL;
+        }
+        pool->size = size;
+        pool->count = count;
+        pool->free = NULL;
+        for (int index = count - 1; index >= 0; index--) {
+            buffer_t buffer = &buffers[buffers_used + index];
+            buffer->pool = pool;
+            buffer->data = &data[index * size];
+            buffer->next = pool->free;
+            pool->free = buffer;
+        }
+        buffers_used += count;
+    }
+    return pool;
+}
+
+uint16_t BufferPoolAvailable(buffer_pool_t pool) {
+    return pool->count;
+}
+
+buffer_t BufferAllocate(buffer_pool_t pool) {
+    SemaforoTomar(pool->available);
+    return BufferTake(pool);
+}
+
+buffer_t BufferTryAllocate(buffer_pool_t pool) {
+    if (!SemaforoIntentarTomar(pool->available)) {
+        return NULL;
+    }
+    return BufferTake(pool);
+}
+
+void BufferRetain(buffer_t buffer) {
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    buffer->references++;
+    __set_PRIMASK(estado);
+}
+
+void BufferRelease(buffer_t buffer) {
+    buffer_pool_t pool = buffer->pool;
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    if (buffer->references > 0) {
+        buffer->references--;
+        if (buffer->references == 0) {
+            buffer->next = pool->free;
+            pool->free = buffer;
+            pool->count++;
+            SemaforoLiberar(pool->available);
+        }
+    }
+    __set_PRIMASK(estado);
+}
+
+void * BufferData(buffer_t buffer) {
+    return buffer->data;
+}
+
+uint16_t BufferSize(buffer_t buffer) {
+    return buffer->pool->size;
+}
+
+uint16_t BufferLength(buffer_t buffer) {
+    return buffer->length;
+}
+
+void BufferSetLength(buffer_t buffer, uint16_t length) {
+    if (length > buffer->pool->size) {
+        length = buffer->pool->size;
+    }
+    buffer->length = length;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
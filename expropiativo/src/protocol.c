@@ -0,0 +1,380 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief COBS framed serial protocol definitions
+ **
+ ** El DMA de recepción recorre en forma circular un buffer dividido en dos descriptores enlazados,
+ ** con una sola interrupción por cada mitad completada. Las posiciones en el flujo recibido se
+ ** cuentan en forma absoluta, de manera que la diferencia con lo escrito por el DMA indica si un
+ ** dato ya fue sobrescrito.
+ ** Como la codificación COBS nunca alarga los datos al decodificarlos, cada trama se decodifica
+ ** sobre si misma y el mensaje se entrega como una referencia al buffer. Solo cuando una trama
+ ** cruza el final del buffer su parte inicial se copia a continuación del mismo para que quede
+ ** contigua.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "protocol.h"
+#include "chip.h"
+#include "ciaa.h"
+#include "crc.h"
+#include "dma.h"
+#include "kernel.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! UART conectada al puerto USB de la placa
+#define PROTOCOL_UART LPC_USART2
+
+//! Cantidad de bytes de la suma de verificación de cada trama
+#define PROTOCOL_CRC_SIZE 2
+
+//! Cantidad máxima de bytes de una trama codificada, sin el delimitador
+#define PROTOCOL_MAX_FRAME                                                                         \
+    (PROTOCOL_MAX_MESSAGE + PROTOCOL_CRC_SIZE + (PROTOCOL_MAX_MESSAGE + PROTOCOL_CRC_SIZE) / 254 + \
+     1)
+
+//! Código COBS de un bloque de 254 bytes sin ceros, que no lleva un cero a continuación
+#define COBS_MAX_CODE 0xFF
+
+/* === Private data type declarations ========================================================== */
+
+//! Ubicación de una trama completa en el flujo recibido
+typedef struct protocol_frame_s {
+    uint32_t start;    //!< Posición absoluta del primer byte de la trama
+    uint16_t length;   //!< Cantidad de bytes de la trama, sin el delimitador
+} protocol_frame_t;
+
+//! Estructura para almacenar el descriptor del protocolo
+struct protocol_s {
+    int rx_channel;                                   //!< Canal de DMA de recepción
+    int tx_channel;                                   //!< Canal de DMA de transmisión
+    volatile uint32_t halves;                         //!< Mitades del buffer completadas por el DMA
+    uint32_t written;                                 //!< Bytes recibidos desde la creación
+    uint32_t scanned;                                 //!< Bytes ya revisados buscando delimitadores
+    uint32_t frame_start;                             //!< Posición del inicio de la trama en curso
+    bool discard;                                     //!< La trama en curso perdió datos
+    protocol_frame_t queue[PROTOCOL_QUEUE_LENGTH];    //!< Tramas pendientes de lectura
+    uint8_t head;                                     //!< Posición de la trama más antigua
+    uint8_t count;                                    //!< Cantidad de tramas en la cola
+    uint32_t errors;                                  //!< Cantidad de tramas descartadas
+    semaforo_t frames;                                //!< Semaforo con la cantidad de tramas
+    semaforo_t tx_lock;                               //!< Acceso exclusivo a la transmisión
+    semaforo_t tx_done;                               //!< Fin de la transmisión por DMA
+    volatile bool tx_error;                           //!< Error en la transmisión por DMA
+    temporizador_t timer;                             //!< Temporizador de búsqueda de tramas
+    DMA_TransferDescriptor_t rx_descriptors[2];       //!< Descriptores circulares de recepción
+    DMA_TransferDescriptor_t tx_descriptor;           //!< Descriptor de transmisión
+    bool allocated;                                   //!< Bandera para indicar que ya fue creado
+    //! Datos recibidos, seguidos por el espacio para completar una trama que cruza el final
+    uint8_t ring[PROTOCOL_RING_SIZE + PROTOCOL_MAX_FRAME];
+    //! Trama codificada en transmisión, incluyendo el delimitador
+    uint8_t tx_frame[PROTOCOL_MAX_FRAME + 1];
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Descriptor del único protocolo, sobre la UART del puerto USB
+static struct protocol_s instance = {0};
+
+/* === Private function declarations =========================================================== */
+
+// Función que codifica un mensaje y su suma de verificación con COBS
+static uint16_t CobsEncode(const uint8_t * data, uint16_t length, const uint8_t * trailer,
+                           uint8_t * frame);
+
+// Función que decodifica una trama COBS en el mismo lugar y devuelve la cantidad de bytes
+static uint16_t CobsDecode(uint8_t * frame, uint16_t length);
+
+// Función que busca delimitadores en los datos recibidos, ejecutada por el temporizador
+static void ProtocolPoll(void * data);
+
+// Función que atiende los errores del canal de recepción
+static void ProtocolRxHandler(void * data, bool error);
+
+// Función que atiende la interrupción del canal de transmisión
+static void ProtocolTxHandler(void * data, bool error);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint16_t CobsEncode(const uint8_t * data, uint16_t length, const uint8_t * trailer,
+                           uint8_t * frame) {
+    uint16_t code_index = 0;
+    uint16_t write = 1;
+    uint8_t code = 1;
+    uint8_t byte;
+
+    for (int index = 0; index < length + PROTOCOL_CRC_SIZE; index++) {
+        byte = (index < length) ? data[index] : trailer[index - length];
+        if (byte) {
+            frame[write++] = byte;
+            code++;
+        }
+        if (!byte || (code == COBS_MAX_CODE)) {
+            frame[code_index] = code;
+            code_index = write++;
+            code = 1;
+        }
+    }
+    frame[code_index] = code;
+    return write;
+}
+
+static uint16_t CobsDecode(uint8_t * frame, uint16_t length) {
+    uint16_t read = 0;
+    uint16_t write = 0;
+    uint8_t code;
+
+    while (read < length) {
+        code = frame[read++];
+        if ((code == 0) || (read + code - 1 > length)) {
+            return 0;
+        }
+        for (int index = 1; index < code; index++) {
+            frame[write++] = frame[read++];
+        }
+        if ((code < COBS_MAX_CODE) && (read < length)) {
+            frame[write++] = 0;
+        }
+    }
+    return write;
+}
+
+static void ProtocolPoll(void * data) {
+    protocol_t protocol = data;
+    uint32_t position;
+    uint32_t halves;
+    uint32_t length;
+    uint32_t estado;
+
+    /* La posición del DMA solo sirve módulo el tamaño del buffer, la cantidad de mitades
+     * completadas da los bytes recibidos aunque entre dos búsquedas llegue más de una vuelta */
+    estado = __get_PRIMASK();
+    __disable_irq();
+    position = LPC_GPDMA->CH[protocol->rx_channel].DESTADDR - (uint32_t)protocol->ring;
+    halves = protocol->halves;
+    __set_PRIMASK(estado);
+    if (position >= PROTOCOL_RING_SIZE) {
+        position = 0;
+    }
+    if (position / (PROTOCOL_RING_SIZE / 2) != halves % 2) {
+        /* El DMA ya pasó a la otra mitad pero su interrupción todavía no se atendió */
+        halves++;
+    }
+    protocol->written = halves * (PROTOCOL_RING_SIZE / 2) + position % (PROTOCOL_RING_SIZE / 2);
+
+    if (protocol->written - protocol->scanned > PROTOCOL_RING_SIZE) {
+        /* Los datos sin revisar fueron sobrescritos, se saltean y se descarta la trama en curso */
+        protocol->errors++;
+        protocol->scanned = protocol->written - PROTOCOL_RING_SIZE;
+        protocol->discard = true;
+    }
+
+    for (; protocol->scanned != protocol->written; protocol->scanned++) {
+        if (protocol->ring[protocol->scanned % PROTOCOL_RING_SIZE] != 0) {
+            continue;
+        }
+        length = protocol->scanned - protocol->frame_start;
+        if (protocol->discard) {
+            protocol->discard = false;
+        } else if ((length <= PROTOCOL_MAX_FRAME) && (protocol->count < PROTOCOL_QUEUE_LENGTH)) {
+            if (length) {
+                protocol->queue[(protocol->head + protocol->count) % PROTOCOL_QUEUE_LENGTH] =
+                    (protocol_frame_t){.start = protocol->frame_start, .length = length};
+                protocol->count++;
+                SemaforoLiberar(protocol->frames);
+            }
+        } else {
+            protocol->errors++;
+        }
+        protocol->frame_start = protocol->scanned + 1;
+    }
+
+    TemporizadorIniciar(protocol->timer, MS_TO_TICKS(PROTOCOL_POLL_PERIOD));
+}
+
+static void ProtocolRxHandler(void * data, bool error) {
+    protocol_t protocol = data;
+
+    /* Cada mitad completada del buffer circular genera una interrupción que se cuenta */
+    if (error) {
+        protocol->errors++;
+    } else {
+        protocol->halves++;
+    }
+}
+
+static void ProtocolTxHandler(void * data, bool error) {
+    protocol_t protocol = data;
+
+    protocol->tx_error = error;
+    SemaforoLiberar(protocol->tx_done);
+}
+
+/* === Public function implementation ========================================================= */
+
+protocol_t ProtocolCreate(uint32_t baudrate) {
+    protocol_t protocol = &instance;
+
+    if (protocol->allocated) {
+        return NULL;
+    }
+    protocol->rx_channel = DmaChannelAllocate(ProtocolRxHandler, protocol);
+    protocol->tx_channel = DmaChannelAllocate(ProtocolTxHandler, protocol);
+    protocol->frames = SemaforoCrear(0);
+    protocol->tx_lock = SemaforoCrear(1);
+    protocol->tx_done = SemaforoCrear(0);
+    protocol->timer = TemporizadorCrear(ProtocolPoll, protocol);
+    if ((protocol->rx_channel < 0) || (protocol->tx_channel < 0) || !protocol->frames ||
+        !protocol->tx_lock || !protocol->tx_done || !protocol->timer) {
+        DmaChannelRelease(protocol->rx_channel);
+        DmaChannelRelease(protocol->tx_channel);
+        SemaforoDestruir(protocol->frames);
+        SemaforoDestruir(protocol->tx_lock);
+        SemaforoDestruir(protocol->tx_done);
+        TemporizadorDestruir(protocol->timer);
+        return NULL;
+    }
+    protocol->allocated = true;
+
+    Chip_SCU_PinMuxSet(UART_USB_TX_PORT, UART_USB_TX_PIN, SCU_MODE_INACT | UART_USB_TX_FUNC);
+    Chip_SCU_PinMuxSet(UART_USB_RX_PORT, UART_USB_RX_PIN,
+                       SCU_MODE_INACT | SCU_MODE_INBUFF_EN | UART_USB_RX_FUNC);
+
+    Chip_UART_Init(PROTOCOL_UART);
+    Chip_UART_SetBaud(PROTOCOL_UART, baudrate);
+    Chip_UART_ConfigData(PROTOCOL_UART, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    Chip_UART_SetupFIFOS(PROTOCOL_UART, UART_FCR_FIFO_EN | UART_FCR_RX_RS | UART_FCR_TX_RS |
+                                            UART_FCR_DMAMODE_SEL | UART_FCR_TRG_LEV0);
+    Chip_UART_TXEnable(PROTOCOL_UART);
+
+    for (int index = 0; index < 2; index++) {
+        Chip_GPDMA_InitDescriptor(LPC_GPDMA, &protocol->rx_descriptors[index], GPDMA_CONN_UART2_Rx,
+                                  (uint32_t)&protocol->ring[index * PROTOCOL_RING_SIZE / 2],
+                                  PROTOCOL_RING_SIZE / 2, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA,
+                                  &protocol->rx_descriptors[1 - index]);
+        protocol->rx_descriptors[index].ctrl |= GPDMA_DMACCxControl_I;
+    }
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, protocol->rx_channel, &protocol->rx_descriptors[0],
+                          GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+
+    TemporizadorIniciar(protocol->timer, MS_TO_TICKS(PROTOCOL_POLL_PERIOD));
+    return protocol;
+}
+
+void ProtocolReceive(protocol_t protocol, protocol_message_t * message) {
+    protocol_frame_t frame;
+    uint32_t offset;
+    uint16_t length;
+    uint16_t crc;
+    uint32_t estado;
+
+    while (1) {
+        SemaforoTomar(protocol->frames);
+
+        estado = __get_PRIMASK();
+        __disable_irq();
+        frame = protocol->queue[protocol->head];
+        protocol->head = (protocol->head + 1) % PROTOCOL_QUEUE_LENGTH;
+        protocol->count--;
+        __set_PRIMASK(estado);
+
+        offset = frame.start % PROTOCOL_RING_SIZE;
+        if (offset + frame.length > PROTOCOL_RING_SIZE) {
+            memcpy(&protocol->ring[PROTOCOL_RING_SIZE], protocol->ring,
+                   offset + frame.length - PROTOCOL_RING_SIZE);
+        }
+        message->data = &protocol->ring[offset];
+        message->position = frame.start;
+
+        length = CobsDecode(message->data, frame.length);
+        if ((length > PROTOCOL_CRC_SIZE) && ProtocolRelease(protocol, message)) {
+            length -= PROTOCOL_CRC_SIZE;
+            crc = (message->data[length] << 8) | message->data[length + 1];
+            if (Crc16(message->data, length) == crc) {
+                message->length = length;
+                return;
+            }
+        }
+        protocol->errors++;
+    }
+}
+
+bool ProtocolRelease(protocol_t protocol, const protocol_message_t * message) {
+    return protocol->written - message->position <= PROTOCOL_RING_SIZE;
+}
+
+bool ProtocolSend(protocol_t protocol, const void * data, uint16_t length) {
+    uint16_t crc = Crc16(data, length);
+    uint8_t trailer[PROTOCOL_CRC_SIZE] = {crc >> 8, crc & 0xFF};
+    uint16_t size;
+    bool result;
+
+    if (length > PROTOCOL_MAX_MESSAGE) {
+        return false;
+    }
+
+    SemaforoTomar(protocol->tx_lock);
+    size = CobsEncode(data, length, trailer, protocol->tx_frame);
+    protocol->tx_frame[size++] = 0;
+
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &protocol->tx_descriptor, (uint32_t)protocol->tx_frame,
+                              GPDMA_CONN_UART2_Tx, size, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA,
+                              NULL);
+    protocol->tx_descriptor.ctrl |= GPDMA_DMACCxControl_I;
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, protocol->tx_channel, &protocol->tx_descriptor,
+                          GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+    SemaforoTomar(protocol->tx_done);
+    result = !protocol->tx_error;
+    SemaforoLiberar(protocol->tx_lock);
+
+    return result;
+}
+
+uint32_t ProtocolErrors(protocol_t protocol) {
+    return protocol->errors;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,396 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief SD card over SPI definitions
+ **
+ ** Cada comando se envía junto con los bytes necesarios para recibir su respuesta en una sola
+ ** transacción de DMA. Las escrituras de varios bloques encolan, para cada bloque, el testigo de
+ ** inicio, los datos tomados directamente de la memoria del llamador y la respuesta de la
+ ** tarjeta, manteniendo la tarjeta seleccionada durante toda la escritura.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "sdcard.h"
+#include "kernel.h"
+#include "spi.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define SD_CMD0 0    //!< Reinicia la tarjeta y la pasa a modo SPI
+#define SD_CMD8 8    //!< Verifica la tensión de alimentación, solo tarjetas versión 2
+#define SD_CMD16 16  //!< Fija el tamaño de bloque de las tarjetas SDSC
+#define SD_CMD17 17  //!< Lee un bloque
+#define SD_CMD25 25  //!< Escribe varios bloques consecutivos
+#define SD_CMD41 41  //!< Inicializa la tarjeta, precedido por CMD55
+#define SD_CMD55 55  //!< Indica que el siguiente comando es especifico de la aplicación
+#define SD_CMD58 58  //!< Lee el registro OCR
+
+//! Respuesta R1 de una tarjeta en estado de reposo
+#define SD_R1_IDLE 0x01
+
+//! Respuesta R1 a un comando no soportado
+#define SD_R1_ILLEGAL 0x04
+
+//! Bit del registro OCR que indica una tarjeta de alta capacidad
+#define SD_OCR_CCS (1 << 30)
+
+//! Testigo de inicio de un bloque leído
+#define SD_TOKEN_READ 0xFE
+
+//! Testigo de inicio de cada bloque de una escritura múltiple
+#define SD_TOKEN_WRITE_MULTIPLE 0xFC
+
+//! Testigo de fin de una escritura múltiple
+#define SD_TOKEN_STOP 0xFD
+
+//! Mascara de la respuesta de la tarjeta a un bloque escrito
+#define SD_DATA_RESPONSE_MASK 0x1F
+
+//! Respuesta de la tarjeta a un bloque aceptado
+#define SD_DATA_ACCEPTED 0x05
+
+//! Frecuencia de reloj del bus en Hz durante la inicialización
+#define SD_INIT_BITRATE 400000
+
+//! Bytes de espera máximos entre un comando y su respuesta
+#define SD_RESPONSE_DELAY 8
+
+//! Tiempo máximo en milisegundos de la inicialización de la tarjeta
+#define SD_INIT_TIMEOUT 1000
+
+//! Tiempo máximo en milisegundos de la programación de un bloque
+#define SD_WRITE_TIMEOUT 250
+
+//! Tiempo máximo en milisegundos hasta recibir el testigo de un bloque leído
+#define SD_READ_TIMEOUT 100
+
+//! Bytes de un comando con su respuesta: espera previa, comando, demora y respuesta R3 o R7
+#define SD_COMMAND_LENGTH (1 + 6 + SD_RESPONSE_DELAY + 4)
+
+//! Bytes que se leen por transacción mientras se espera a la tarjeta
+#define SD_POLL_LENGTH 16
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de una tarjeta SD
+struct sd_card_s {
+    spi_device_t slow;                   //!< Dispositivo a la frecuencia de inicialización
+    spi_device_t fast;                   //!< Dispositivo a la frecuencia de trabajo
+    spi_device_t device;                 //!< Dispositivo que se usa actualmente
+    bool high_capacity;                  //!< Direcciona por bloque en lugar de por byte
+    struct spi_transfer_s transfers[3];  //!< Transacciones de la escritura de un bloque
+    uint8_t buffer[SD_COMMAND_LENGTH];   //!< Comando y respuesta de la tarjeta
+    uint8_t trailer[3];                  //!< Suma de verificación y respuesta a un bloque
+    bool allocated;                      //!< Bandera para indicar que el descriptor esta en uso
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Testigo que se transmite antes de cada bloque de una escritura múltiple
+static const uint8_t token_write = SD_TOKEN_WRITE_MULTIPLE;
+
+//! Testigo de fin de escritura seguido del byte de espera que requiere la tarjeta
+static const uint8_t token_stop[] = {SD_TOKEN_STOP, 0xFF};
+
+/* === Private function declarations =========================================================== */
+
+// Function para asignar un descriptor para crear una nueva tarjeta
+static sd_card_t SdCardAllocate(void);
+
+// Función que realiza una transacción con la tarjeta y espera que termine
+static bool SdCardTransfer(sd_card_t card, const uint8_t * tx, uint8_t * rx, uint16_t length,
+                           bool hold);
+
+// Función que envía un comando y devuelve la respuesta R1, dejando la tarjeta seleccionada
+static uint8_t SdCardCommand(sd_card_t card, uint8_t command, uint32_t argument, uint32_t * extra);
+
+// Función que envía un comando especifico de la aplicación
+static uint8_t SdCardAppCommand(sd_card_t card, uint8_t command, uint32_t argument);
+
+// Función que libera la selección de la tarjeta con ocho ciclos de reloj adicionales
+static void SdCardRelease(sd_card_t card);
+
+// Función que espera a que la tarjeta termine una operación interna
+static bool SdCardWaitReady(sd_card_t card, uint32_t timeout);
+
+// Función que realiza la secuencia de inicialización de la tarjeta
+static bool SdCardInit(sd_card_t card);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static sd_card_t SdCardAllocate(void) {
+    sd_card_t card = NULL;
+
+    static struct sd_card_s instances[SD_CARD_INSTANCES] = {0};
+
+    for (int index = 0; index < SD_CARD_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            card = &instances[index];
+            break;
+        }
+    }
+    return card;
+}
+
+static bool SdCardTransfer(sd_card_t card, const uint8_t * tx, uint8_t * rx, uint16_t length,
+                           bool hold) {
+    struct spi_transfer_s transfer = {
+        .device = card->device,
+        .tx = tx,
+        .rx = rx,
+        .length = length,
+        .hold = hold,
+    };
+
+    return SpiTransfer(&transfer);
+}
+
+static uint8_t SdCardCommand(sd_card_t card, uint8_t command, uint32_t argument, uint32_t * extra) {
+    uint8_t * buffer = card->buffer;
+    uint8_t response = 0xFF;
+    int index;
+
+    memset(buffer, 0xFF, sizeof(card->buffer));
+    buffer[1] = 0x40 | command;
+    buffer[2] = argument >> 24;
+    buffer[3] = argument >> 16;
+    buffer[4] = argument >> 8;
+    buffer[5] = argument;
+    /* Solo CMD0 y CMD8 se verifican antes de desactivar la suma de verificación */
+    buffer[6] = (command == SD_CMD0) ? 0x95 : (command == SD_CMD8) ? 0x87 : 0x01;
+
+    if (!SdCardTransfer(card, buffer, buffer, sizeof(card->buffer), true)) {
+        return 0xFF;
+    }
+
+    for (index = 7; index < 7 + SD_RESPONSE_DELAY; index++) {
+        if ((buffer[index] & 0x80) == 0) {
+            response = buffer[index];
+            break;
+        }
+    }
+    if (extra && (response != 0xFF)) {
+        *extra = ((uint32_t)buffer[index + 1] << 24) | ((uint32_t)buffer[index + 2] << 16) |
+                 ((uint32_t)buffer[index + 3] << 8) | buffer[index + 4];
+    }
+    return response;
+}
+
+static uint8_t SdCardAppCommand(sd_card_t card, uint8_t command, uint32_t argument) {
+    uint8_t response = SdCardCommand(card, SD_CMD55, 0, NULL);
+
+    if (response <= SD_R1_IDLE) {
+        response = SdCardCommand(card, command, argument, NULL);
+    }
+    return response;
+}
+
+static void SdCardRelease(sd_card_t card) {
+    SdCardTransfer(card, NULL, NULL, 1, false);
+}
+
+static bool SdCardWaitReady(sd_card_t card, uint32_t timeout) {
+    uint32_t start = TiempoSistema();
+    uint8_t * buffer = card->buffer;
+
+    do {
+        if (!SdCardTransfer(card, NULL, buffer, SD_POLL_LENGTH, true)) {
+            return false;
+        }
+        if (buffer[SD_POLL_LENGTH - 1] == 0xFF) {
+            return true;
+        }
+    } while (TiempoSistema() - start < MS_TO_TICKS(timeout));
+    return false;
+}
+
+static bool SdCardInit(sd_card_t card) {
+    struct spi_transfer_s clocks = {
+        .device = card->slow,
+        .length = 10,
+        .unselected = true,
+    };
+    uint32_t start;
+    uint32_t extra = 0;
+    uint8_t response;
+    bool version2;
+
+    /* La tarjeta necesita al menos 74 ciclos de reloj sin seleccionar para entrar en servicio */
+    card->device = card->slow;
+    SpiTransfer(&clocks);
+
+    response = SdCardCommand(card, SD_CMD0, 0, NULL);
+    if (response != SD_R1_IDLE) {
+        SdCardRelease(card);
+        return false;
+    }
+
+    response = SdCardCommand(card, SD_CMD8, 0x1AA, &extra);
+    version2 = !(response & SD_R1_ILLEGAL);
+    if (version2 && ((extra & 0xFFF) != 0x1AA)) {
+        SdCardRelease(card);
+        return false;
+    }
+
+    start = TiempoSistema();
+    do {
+        response = SdCardAppCommand(card, SD_CMD41, version2 ? (1 << 30) : 0);
+    } while ((response == SD_R1_IDLE) &&
+             (TiempoSistema() - start < MS_TO_TICKS(SD_INIT_TIMEOUT)));
+    if (response != 0) {
+        SdCardRelease(card);
+        return false;
+    }
+
+    card->high_capacity = false;
+    if (version2 && (SdCardCommand(card, SD_CMD58, 0, &extra) == 0)) {
+        card->high_capacity = (extra & SD_OCR_CCS) != 0;
+    }
+    if (!card->high_capacity && (SdCardCommand(card, SD_CMD16, SD_BLOCK_SIZE, NULL) != 0)) {
+        SdCardRelease(card);
+        return false;
+    }
+    SdCardRelease(card);
+
+    card->device = card->fast;
+    return true;
+}
+
+/* === Public function implementation ========================================================= */
+
+sd_card_t SdCardCreate(const spi_select_t * select) {
+    sd_card_t card = SdCardAllocate();
+
+    if (card) {
+        card->slow = SpiDeviceCreate(select, 0, SD_INIT_BITRATE);
+        card->fast = SpiDeviceCreate(select, 0, SD_CARD_BITRATE);
+        if (!card->slow || !card->fast || !SdCardInit(card)) {
+            /* Se liberan los recursos para poder intentar con otra tarjeta más adelante */
+            SpiDeviceDestroy(card->slow);
+            SpiDeviceDestroy(card->fast);
+            card->slow = NULL;
+            card->fast = NULL;
+            card->device = NULL;
+            card->allocated = false;
+            card = NULL;
+        }
+    }
+    return card;
+}
+
+bool SdCardRead(sd_card_t card, uint32_t block, uint8_t * data) {
+    uint32_t address = card->high_capacity ? block : block * SD_BLOCK_SIZE;
+    uint32_t start;
+    bool result = false;
+
+    if (SdCardCommand(card, SD_CMD17, address, NULL) == 0) {
+        start = TiempoSistema();
+        do {
+            SdCardTransfer(card, NULL, card->buffer, 1, true);
+        } while ((card->buffer[0] == 0xFF) &&
+                 (TiempoSistema() - start < MS_TO_TICKS(SD_READ_TIMEOUT)));
+
+        if (card->buffer[0] == SD_TOKEN_READ) {
+            result = SdCardTransfer(card, NULL, data, SD_BLOCK_SIZE, true) &&
+                     SdCardTransfer(card, NULL, card->trailer, 2, true);
+        }
+    }
+    SdCardRelease(card);
+    return result;
+}
+
+bool SdCardWriteStart(sd_card_t card, uint32_t block) {
+    uint32_t address = card->high_capacity ? block : block * SD_BLOCK_SIZE;
+
+    if (SdCardCommand(card, SD_CMD25, address, NULL) != 0) {
+        SdCardRelease(card);
+        return false;
+    }
+    return true;
+}
+
+bool SdCardWriteBlocks(sd_card_t card, const uint8_t * data, uint16_t count) {
+    struct spi_transfer_s * token = &card->transfers[0];
+    struct spi_transfer_s * block = &card->transfers[1];
+    struct spi_transfer_s * trailer = &card->transfers[2];
+
+    *token = (struct spi_transfer_s){
+        .device = card->device, .tx = &token_write, .length = 1, .hold = true};
+    *trailer = (struct spi_transfer_s){
+        .device = card->device, .rx = card->trailer, .length = 3, .hold = true};
+
+    for (int index = 0; index < count; index++) {
+        /* La suma de verificación está desactivada, se envían 0xFF en su lugar */
+        *block = (struct spi_transfer_s){.device = card->device,
+                                         .tx = data + index * SD_BLOCK_SIZE,
+                                         .length = SD_BLOCK_SIZE,
+                                         .hold = true};
+        if (!SpiSubmit(token) || !SpiSubmit(block) || !SpiSubmit(trailer)) {
+            return false;
+        }
+        if (!SpiWait(token) || !SpiWait(block) || !SpiWait(trailer)) {
+            return false;
+        }
+        if ((card->trailer[2] & SD_DATA_RESPONSE_MASK) != SD_DATA_ACCEPTED) {
+            return false;
+        }
+        if (!SdCardWaitReady(card, SD_WRITE_TIMEOUT)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SdCardWriteStop(sd_card_t card) {
+    bool result;
+
+    result = SdCardTransfer(card, token_stop, NULL, sizeof(token_stop), true) &&
+             SdCardWaitReady(card, SD_WRITE_TIMEOUT);
+    SdCardRelease(card);
+    return result;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
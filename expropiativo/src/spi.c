@@ -0,0 +1,319 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Asynchronous SPI master definitions
+ **
+ ** Las transacciones se encolan en un buffer circular por bus y se ejecutan una detrás de otra
+ ** con dos canales de DMA, uno para transmitir y otro para recibir. Como el SSP recibe un byte
+ ** por cada byte que transmite, el fin del canal de recepción indica que la transacción terminó,
+ ** y en esa misma interrupción se libera al dispositivo y se arranca la siguiente transacción.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "spi.h"
+#include "chip.h"
+#include "ciaa.h"
+#include "dma.h"
+#include "kernel.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de un dispositivo conectado al bus
+struct spi_device_s {
+    uint8_t port;       //!< Puerto GPIO de la selección del dispositivo
+    uint8_t pin;        //!< Terminal del puerto GPIO de la selección del dispositivo
+    uint32_t mode;      //!< Configuración de fase y polaridad del reloj
+    uint32_t bitrate;   //!< Frecuencia de reloj del bus en Hz
+    semaforo_t done;    //!< Semaforo liberado al terminar cada transacción del dispositivo
+    bool allocated;     //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Estructura para almacenar el descriptor de un bus SPI
+struct spi_bus_s {
+    LPC_SSP_T * ssp;                          //!< Controlador SSP del bus
+    uint32_t tx_connection;                   //!< Conexión del DMA para transmitir
+    uint32_t rx_connection;                   //!< Conexión del DMA para recibir
+    int tx_channel;                           //!< Canal de DMA para transmitir
+    int rx_channel;                           //!< Canal de DMA para recibir
+    spi_transfer_t queue[SPI_QUEUE_LENGTH];   //!< Transacciones pendientes
+    uint8_t head;                             //!< Posición de la transacción en curso
+    uint8_t count;                            //!< Cantidad de transacciones en la cola
+    spi_device_t device;                      //!< Dispositivo con el que está configurado el bus
+    DMA_TransferDescriptor_t tx_descriptor;   //!< Descriptor del canal de transmisión
+    DMA_TransferDescriptor_t rx_descriptor;   //!< Descriptor del canal de recepción
+};
+
+/* === Private variable declarations =========================================================== */
+
+//! Bus SPI disponible en el conector de la placa
+static struct spi_bus_s spi1 = {
+    .ssp = LPC_SSP1,
+    .tx_connection = GPDMA_CONN_SSP1_Tx,
+    .rx_connection = GPDMA_CONN_SSP1_Rx,
+    .tx_channel = -1,
+    .rx_channel = -1,
+};
+
+//! Modos SPI en el formato del controlador SSP
+static const uint32_t modes[] = {SSP_CLOCK_MODE0, SSP_CLOCK_MODE1, SSP_CLOCK_MODE2,
+                                 SSP_CLOCK_MODE3};
+
+//! Dato que se transmite cuando la transacción no tiene datos a transmitir
+static const uint8_t dummy_tx = 0xFF;
+
+//! Destino de los datos recibidos cuando la transacción no los necesita
+static uint8_t dummy_rx;
+
+/* === Private function declarations =========================================================== */
+
+// Function para asignar un descriptor para crear un nuevo dispositivo
+static spi_device_t SpiDeviceAllocate(void);
+
+// Función que configura el controlador SSP y los canales de DMA del bus
+static bool SpiBusInit(struct spi_bus_s * bus);
+
+// Función que arranca la transacción ubicada al frente de la cola
+static void SpiStart(struct spi_bus_s * bus);
+
+// Función que termina la transacción en curso y arranca la siguiente de la cola
+static void SpiFinish(struct spi_bus_s * bus, bool error);
+
+// Función que atiende los errores del canal de transmisión
+static void SpiTxHandler(void * data, bool error);
+
+// Función que atiende la interrupción del canal de recepción al terminar una transacción
+static void SpiRxHandler(void * data, bool error);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static spi_device_t SpiDeviceAllocate(void) {
+    spi_device_t device = NULL;
+
+    static struct spi_device_s instances[SPI_DEVICE_INSTANCES] = {0};
+
+    for (int index = 0; index < SPI_DEVICE_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            device = &instances[index];
+            break;
+        }
+    }
+    return device;
+}
+
+static bool SpiBusInit(struct spi_bus_s * bus) {
+    bus->tx_channel = DmaChannelAllocate(SpiTxHandler, bus);
+    bus->rx_channel = DmaChannelAllocate(SpiRxHandler, bus);
+    if ((bus->tx_channel < 0) || (bus->rx_channel < 0)) {
+        /* Se devuelve el canal que se pudo reservar para que el próximo intento empiece de cero */
+        DmaChannelRelease(bus->tx_channel);
+        DmaChannelRelease(bus->rx_channel);
+        bus->tx_channel = -1;
+        bus->rx_channel = -1;
+        return false;
+    }
+
+    Chip_SCU_PinMuxSet(SPI_MISO_PORT, SPI_MISO_PIN,
+                       SCU_MODE_INBUFF_EN | SCU_MODE_ZIF_DIS | SPI_MISO_FUNC);
+    Chip_SCU_PinMuxSet(SPI_MOSI_PORT, SPI_MOSI_PIN, SCU_MODE_HIGHSPEEDSLEW_EN | SPI_MOSI_FUNC);
+    Chip_SCU_PinMuxSet(SPI_SCK_PORT, SPI_SCK_PIN, SCU_MODE_HIGHSPEEDSLEW_EN | SPI_SCK_FUNC);
+
+    Chip_SSP_Init(bus->ssp);
+    Chip_SSP_SetMaster(bus->ssp, true);
+    Chip_SSP_Enable(bus->ssp);
+    Chip_SSP_DMA_Enable(bus->ssp);
+    return true;
+}
+
+static void SpiStart(struct spi_bus_s * bus) {
+    spi_transfer_t transfer = bus->queue[bus->head];
+    spi_device_t device = transfer->device;
+
+    if (bus->device != device) {
+        Chip_SSP_SetFormat(bus->ssp, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, device->mode);
+        Chip_SSP_SetBitRate(bus->ssp, device->bitrate);
+        bus->device = device;
+    }
+    if (!transfer->unselected) {
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, device->port, device->pin, false);
+    }
+
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &bus->rx_descriptor, bus->rx_connection,
+                              (uint32_t)(transfer->rx ? transfer->rx : &dummy_rx),
+                              transfer->length, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, NULL);
+    bus->rx_descriptor.ctrl |= GPDMA_DMACCxControl_I;
+    if (!transfer->rx) {
+        bus->rx_descriptor.ctrl &= ~GPDMA_DMACCxControl_DI;
+    }
+
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &bus->tx_descriptor,
+                              (uint32_t)(transfer->tx ? transfer->tx : &dummy_tx),
+                              bus->tx_connection, transfer->length,
+                              GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, NULL);
+    /* El canal de transmisión solo interrumpe por errores, la recepción marca el final */
+    bus->tx_descriptor.ctrl &= ~GPDMA_DMACCxControl_I;
+    if (!transfer->tx) {
+        bus->tx_descriptor.ctrl &= ~GPDMA_DMACCxControl_SI;
+    }
+
+    /* La recepción se habilita primero para no perder el primer byte */
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, bus->rx_channel, &bus->rx_descriptor,
+                          GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, bus->tx_channel, &bus->tx_descriptor,
+                          GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+}
+
+static void SpiFinish(struct spi_bus_s * bus, bool error) {
+    spi_transfer_t transfer = bus->queue[bus->head];
+
+    if (error) {
+        /* Se detienen los dos canales, con sus interrupciones pendientes, y se vacía el SSP */
+        Chip_GPDMA_Stop(LPC_GPDMA, bus->tx_channel);
+        Chip_GPDMA_Stop(LPC_GPDMA, bus->rx_channel);
+        Chip_SSP_Int_FlushData(bus->ssp);
+    }
+    if (!transfer->hold || error) {
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, transfer->device->port, transfer->device->pin, true);
+    }
+    transfer->error = error;
+    transfer->done = true;
+    SemaforoLiberar(transfer->device->done);
+
+    bus->head = (bus->head + 1) % SPI_QUEUE_LENGTH;
+    bus->count--;
+    if (bus->count) {
+        SpiStart(bus);
+    }
+}
+
+static void SpiTxHandler(void * data, bool error) {
+    struct spi_bus_s * bus = data;
+
+    /* Sin transmisión el canal de recepción nunca termina, la transacción se aborta aquí */
+    if (error) {
+        SpiFinish(bus, true);
+    }
+}
+
+static void SpiRxHandler(void * data, bool error) {
+    SpiFinish(data, error);
+}
+
+/* === Public function implementation ========================================================= */
+
+spi_device_t SpiDeviceCreate(const spi_select_t * select, uint8_t mode, uint32_t bitrate) {
+    spi_device_t device = NULL;
+
+    if (((spi1.tx_channel < 0) || (spi1.rx_channel < 0)) && !SpiBusInit(&spi1)) {
+        return NULL;
+    }
+
+    if (mode < sizeof(modes) / sizeof(modes[0])) {
+        device = SpiDeviceAllocate();
+    }
+
+    if (device) {
+        device->done = SemaforoCrear(0);
+        if (!device->done) {
+            device->allocated = false;
+            return NULL;
+        }
+        device->port = select->port;
+        device->pin = select->pin;
+        device->mode = modes[mode];
+        device->bitrate = bitrate;
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, device->port, device->pin, true);
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, device->port, device->pin, true);
+        Chip_SCU_PinMuxSet(select->scu_port, select->scu_pin, SCU_MODE_INACT | select->function);
+    }
+    return device;
+}
+
+void SpiDeviceDestroy(spi_device_t device) {
+    if (device) {
+        SemaforoDestruir(device->done);
+        device->done = NULL;
+        device->allocated = false;
+    }
+}
+
+bool SpiSubmit(spi_transfer_t transfer) {
+    bool result = false;
+    uint32_t estado;
+
+    if ((transfer->length == 0) || (transfer->length > SPI_MAX_LENGTH)) {
+        return false;
+    }
+    transfer->done = false;
+    transfer->error = false;
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    if (spi1.count < SPI_QUEUE_LENGTH) {
+        spi1.queue[(spi1.head + spi1.count) % SPI_QUEUE_LENGTH] = transfer;
+        spi1.count++;
+        if (spi1.count == 1) {
+            SpiStart(&spi1);
+        }
+        result = true;
+    }
+    __set_PRIMASK(estado);
+
+    return result;
+}
+
+bool SpiWait(spi_transfer_t transfer) {
+    while (!transfer->done) {
+        SemaforoTomar(transfer->device->done);
+    }
+    return !transfer->error;
+}
+
+bool SpiTransfer(spi_transfer_t transfer) {
+    return SpiSubmit(transfer) && SpiWait(transfer);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
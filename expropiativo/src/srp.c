@@ -0,0 +1,295 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Stack Resource Policy jobs definitions
+ **
+ ** Los despachadores de los niveles se instalan con el envoltorio del núcleo, de manera que los
+ ** trabajos que despiertan tareas producen un único cambio de contexto al terminar. El despachador
+ ** del nivel más bajo en ejecución cambia a la pila compartida y los niveles que lo expropian
+ ** siguen sobre ella, por lo que las pilas de las tareas solo deben alojar el marco de excepción.
+ **
+ ** \addtogroup kernel Kernel
+ ** \brief Núcleo de planificación expropiativo
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "srp.h"
+#include "chip.h"
+#include "kernel.h"
+#include "vector.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Convierte el valor de una macro en texto para usarlo en el ensamblador
+#define TEXTO(valor) TEXTO_LITERAL(valor)
+
+//! Convierte un símbolo en texto
+#define TEXTO_LITERAL(valor) #valor
+
+//! Prioridad en el NVIC del nivel más bajo, inmediatamente por encima de PendSV y SysTick
+#define SRP_LOWEST_PRIORITY ((1 << __NVIC_PRIO_BITS) - 2)
+
+//! Prioridad en el NVIC del despachador de un nivel
+#define PRIORIDAD_NIVEL(nivel) (SRP_LOWEST_PRIORITY - (nivel))
+
+//! Valor de BASEPRI que enmascara un nivel y todos los inferiores
+#define BASEPRI_NIVEL(nivel) (PRIORIDAD_NIVEL(nivel) << (8 - __NVIC_PRIO_BITS))
+
+/* === Private data type declarations ========================================================== */
+
+//! Estructura para almacenar el descriptor de un trabajo
+struct trabajo_s {
+    trabajo_funcion_t funcion;    //!< Función que implementa el trabajo
+    void * argumento;             //!< Valor que recibe la función
+    struct trabajo_s * siguiente; //!< Siguiente trabajo pendiente del mismo nivel
+    uint16_t pendientes;          //!< Cantidad de activaciones todavía no ejecutadas
+    uint8_t nivel;                //!< Nivel de expropiación del trabajo
+    bool allocated;               //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Estructura para almacenar el descriptor de un recurso compartido
+struct recurso_s {
+    uint8_t techo;     //!< Nivel más alto de los trabajos que usan el recurso
+    uint32_t anterior; //!< Valor de BASEPRI antes de tomar el recurso
+    bool allocated;    //!< Bandera para indicar que el descriptor esta en uso
+};
+
+//! Trabajos pendientes de un nivel, en orden de activación
+typedef struct cola_trabajos_s {
+    trabajo_t primero; //!< Próximo trabajo a ejecutar
+    trabajo_t ultimo;  //!< Último trabajo activado
+} cola_trabajos_t;
+
+/* === Private variable declarations =========================================================== */
+
+//! Interrupción que despacha cada nivel
+static const IRQn_Type interrupciones[SRP_LEVELS] = SRP_LEVEL_IRQS;
+
+//! Trabajos pendientes de cada nivel
+static cola_trabajos_t colas[SRP_LEVELS] = {0};
+
+//! Pila compartida por todos los trabajos, referenciada desde el despachador en ensamblador
+__attribute__((used, aligned(8))) static uint8_t pila_compartida[SRP_STACK_SIZE];
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Rutina de servicio común a todos los niveles
+ *
+ * Si la interrupción no llegó sobre la pila compartida cambia a ella, ejecuta los trabajos del
+ * nivel y vuelve a la pila original.
+ */
+static void SrpDespachar(void);
+
+/**
+ * @brief Función que ejecuta todos los trabajos pendientes del nivel que se está atendiendo
+ */
+__attribute__((used)) static void SrpEjecutar(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+__attribute__((naked)) static void SrpDespachar(void) {
+    __asm__("push {r4, lr}                              \n"
+            "mov r4, sp                                 \n"
+            "ldr r0, =pila_compartida                   \n"
+            "ldr r1, =pila_compartida + " TEXTO(SRP_STACK_SIZE) "\n"
+            "cmp r4, r0                                 \n"
+            "bls 1f                                     \n"
+            "cmp r4, r1                                 \n"
+            "bhi 1f                                     \n"
+            "bl SrpEjecutar                             \n"
+            "pop {r4, pc}                               \n"
+            "1:                                         \n"
+            "mov sp, r1                                 \n"
+            "bl SrpEjecutar                             \n"
+            "mov sp, r4                                 \n"
+            "pop {r4, pc}                               \n");
+}
+
+static void SrpEjecutar(void) {
+    int irq = (int)(__get_IPSR() & SCB_ICSR_VECTACTIVE_Msk) - 16;
+    cola_trabajos_t * cola = NULL;
+    trabajo_t trabajo;
+    uint32_t estado;
+
+    for (int nivel = 0; nivel < SRP_LEVELS; nivel++) {
+        if ((int)interrupciones[nivel] == irq) {
+            cola = &colas[nivel];
+            break;
+        }
+    }
+    if (cola == NULL) {
+        return;
+    }
+
+    while (1) {
+        estado = __get_PRIMASK();
+        __disable_irq();
+        trabajo = cola->primero;
+        if (trabajo == NULL) {
+            __set_PRIMASK(estado);
+            break;
+        }
+        cola->primero = trabajo->siguiente;
+        trabajo->siguiente = NULL;
+        if (cola->primero == NULL) {
+            cola->ultimo = NULL;
+        }
+        trabajo->pendientes--;
+        if (trabajo->pendientes) {
+            /* Las activaciones repetidas ceden el turno a los demás trabajos del nivel */
+            if (cola->ultimo) {
+                cola->ultimo->siguiente = trabajo;
+            } else {
+                cola->primero = trabajo;
+            }
+            cola->ultimo = trabajo;
+        }
+        __set_PRIMASK(estado);
+
+        trabajo->funcion(trabajo->argumento);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void TrabajosIniciar(void) {
+    for (int indice = 0; indice < SRP_STACK_SIZE; indice++) {
+        pila_compartida[indice] = STACK_PATTERN;
+    }
+    for (int nivel = 0; nivel < SRP_LEVELS; nivel++) {
+        if (!VectorInstall(interrupciones[nivel], SrpDespachar, PRIORIDAD_NIVEL(nivel), true)) {
+            Error();
+        }
+    }
+}
+
+trabajo_t TrabajoCrear(trabajo_funcion_t funcion, void * argumento, uint8_t nivel) {
+    trabajo_t trabajo = NULL;
+
+    static struct trabajo_s instances[SRP_JOB_INSTANCES] = {0};
+
+    if ((funcion == NULL) || (nivel >= SRP_LEVELS)) {
+        return NULL;
+    }
+
+    for (int index = 0; index < SRP_JOB_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            trabajo = &instances[index];
+            break;
+        }
+    }
+
+    if (trabajo) {
+        trabajo->funcion = funcion;
+        trabajo->argumento = argumento;
+        trabajo->nivel = nivel;
+    }
+    return trabajo;
+}
+
+void TrabajoActivar(trabajo_t trabajo) {
+    cola_trabajos_t * cola = &colas[trabajo->nivel];
+    uint32_t estado = __get_PRIMASK();
+
+    __disable_irq();
+    if (trabajo->pendientes++ == 0) {
+        if (cola->ultimo) {
+            cola->ultimo->siguiente = trabajo;
+        } else {
+            cola->primero = trabajo;
+        }
+        cola->ultimo = trabajo;
+    }
+    NVIC_SetPendingIRQ(interrupciones[trabajo->nivel]);
+    __set_PRIMASK(estado);
+}
+
+recurso_t RecursoCrear(uint8_t techo) {
+    recurso_t recurso = NULL;
+
+    static struct recurso_s instances[SRP_RESOURCE_INSTANCES] = {0};
+
+    if (techo >= SRP_LEVELS) {
+        return NULL;
+    }
+
+    for (int index = 0; index < SRP_RESOURCE_INSTANCES; index++) {
+        if (!instances[index].allocated) {
+            instances[index].allocated = true;
+            recurso = &instances[index];
+            break;
+        }
+    }
+
+    if (recurso) {
+        recurso->techo = techo;
+    }
+    return recurso;
+}
+
+void RecursoTomar(recurso_t recurso) {
+    uint32_t anterior = __get_BASEPRI();
+    uint32_t techo = BASEPRI_NIVEL(recurso->techo);
+
+    /* Un valor nulo de BASEPRI no enmascara nada, y los menores enmascaran más niveles */
+    if ((anterior == 0) || (techo < anterior)) {
+        __set_BASEPRI(techo);
+    }
+    recurso->anterior = anterior;
+}
+
+void RecursoLiberar(recurso_t recurso) {
+    __set_BASEPRI(recurso->anterior);
+}
+
+uint16_t TrabajosUsoPila(void) {
+    uint16_t libre = 0;
+
+    while ((libre < SRP_STACK_SIZE) && (pila_compartida[libre] == STACK_PATTERN)) {
+        libre++;
+    }
+    return SRP_STACK_SIZE - libre;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
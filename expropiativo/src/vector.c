@@ -0,0 +1,143 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief RAM vector table definitions
+ **
+ ** Las rutinas instaladas con envoltorio no se ubican directamente en la tabla, sino en un arreglo
+ ** auxiliar. La tabla apunta a una rutina común que identifica la interrupción con el registro
+ ** IPSR y llama a la rutina instalada entre la entrada y la salida informadas al núcleo.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "vector.h"
+#include "kernel.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+//! Número de la primera excepción que corresponde a una interrupción de periférico
+#define VECTOR_IRQ_OFFSET 16
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! Tabla de vectores en RAM, alineada a la potencia de dos siguiente a su tamaño como exige VTOR
+static vector_handler_t table[VECTOR_COUNT] __attribute__((aligned(512)));
+
+//! Rutinas instaladas con envoltorio, indexadas por número de excepción
+static vector_handler_t wrapped_handlers[VECTOR_COUNT] = {0};
+
+//! Indica que la tabla ya se trasladó a la RAM
+static bool relocated = false;
+
+/* === Private function declarations =========================================================== */
+
+// Rutina común que informa al núcleo la entrada y la salida de las interrupciones con envoltorio
+static void VectorDispatch(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void VectorDispatch(void) {
+    uint32_t exception = __get_IPSR() & SCB_ICSR_VECTACTIVE_Msk;
+
+    InterrupcionEntrar();
+    wrapped_handlers[exception]();
+    InterrupcionSalir();
+}
+
+/* === Public function implementation ========================================================== */
+
+void VectorTableRelocate(void) {
+    const vector_handler_t * current = (const vector_handler_t *)SCB->VTOR;
+    uint32_t estado;
+
+    if (relocated) {
+        return;
+    }
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    for (int index = 0; index < VECTOR_COUNT; index++) {
+        table[index] = current[index];
+    }
+    __DSB();
+    SCB->VTOR = (uint32_t)table;
+    __DSB();
+    __ISB();
+    relocated = true;
+    __set_PRIMASK(estado);
+}
+
+bool VectorInstall(IRQn_Type irq, vector_handler_t handler, uint8_t priority, bool wrapped) {
+    int exception = (int)irq + VECTOR_IRQ_OFFSET;
+    uint32_t estado;
+
+    /* Solo se pueden reemplazar las excepciones configurables y las interrupciones */
+    if ((exception < 4) || (exception >= VECTOR_COUNT) || (handler == NULL)) {
+        return false;
+    }
+
+    VectorTableRelocate();
+
+    estado = __get_PRIMASK();
+    __disable_irq();
+    if (wrapped) {
+        wrapped_handlers[exception] = handler;
+        table[exception] = VectorDispatch;
+    } else {
+        wrapped_handlers[exception] = NULL;
+        table[exception] = handler;
+    }
+    __DSB();
+    NVIC_SetPriority(irq, priority);
+    if (irq >= 0) {
+        NVIC_EnableIRQ(irq);
+    }
+    __set_PRIMASK(estado);
+
+    return true;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
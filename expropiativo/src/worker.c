@@ -0,0 +1,119 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Worker task pool definitions
+ **
+ ** Los trabajos se encolan por referencia en una cola del kernel. Las tareas de trabajo libres
+ ** quedan bloqueadas en la cola y el kernel despierta a una por cada trabajo encolado.
+ **
+ ** \addtogroup hal HAL
+ ** \brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "worker.h"
+#include "kernel.h"
+#include <stddef.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+//! Cola con los trabajos pendientes
+static cola_t jobs = NULL;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+bool WorkerPoolCreate(void) {
+    if (jobs == NULL) {
+        jobs = ColaCrear(WORKER_QUEUE_LENGTH);
+    }
+    return (jobs != NULL);
+}
+
+void WorkerSubmit(worker_job_t job) {
+    job->done = false;
+    job->task = TASK_COUNT;
+    ColaEnviar(jobs, job);
+}
+
+bool WorkerTrySubmit(worker_job_t job) {
+    job->done = false;
+    job->task = TASK_COUNT;
+    return ColaIntentarEnviar(jobs, job);
+}
+
+void WorkerRun(worker_job_t job) {
+    job->done = false;
+    job->task = TareaActual();
+    ColaEnviar(jobs, job);
+    while (!job->done) {
+        TareaEsperarNotificacion();
+    }
+}
+
+uint8_t WorkerPending(void) {
+    return ColaCantidad(jobs);
+}
+
+void WorkerTask(void) {
+    worker_job_t job;
+    int task;
+
+    while (1) {
+        job = ColaRecibir(jobs);
+        job->function(job->data);
+
+        task = job->task;
+        job->done = true;
+        if (task < TASK_COUNT) {
+            TareaNotificar(task);
+        }
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */